@@ -0,0 +1,277 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements packet traffic arbitration (PTA) control of the nRF 802.15.4 radio driver.
+ *
+ */
+
+#include "nrf_coex_control_api.h"
+
+#include <assert.h>
+
+#include "compiler_abstraction.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_utils.h"
+#include "nrf.h"
+#include "hal/nrf_gpio.h"
+#include "hal/nrf_gpiote.h"
+#include "hal/nrf_ppi.h"
+#include "hal/nrf_radio.h"
+
+#if NRF_802154_COEX_ENABLED
+
+static nrf_coex_control_cfg_t   NRF_802154_PER_INSTANCE(m_cfg);   /**< PTA controller configuration. */
+static nrf_coex_control_stats_t NRF_802154_PER_INSTANCE(m_stats); /**< PTA statistics. */
+#define m_cfg   NRF_802154_INSTANCE_OF(m_cfg)
+#define m_stats NRF_802154_INSTANCE_OF(m_stats)
+
+/** Get address of GPIOTE task that sets given output pin to the requested level. */
+static uint32_t gpiote_task_address_get(const nrf_coex_control_pin_cfg_t * p_pin_cfg,
+                                        uint8_t                            gpiote_ch_id,
+                                        bool                               active)
+{
+    return (active == p_pin_cfg->active_high) ?
+           (uint32_t)(&NRF_GPIOTE->TASKS_SET[gpiote_ch_id]) :
+           (uint32_t)(&NRF_GPIOTE->TASKS_CLR[gpiote_ch_id]);
+}
+
+/** Check if the co-located radio grants the medium. */
+static bool grant_is_active(void)
+{
+    if (!m_cfg.grant_cfg.enable)
+    {
+        return true;
+    }
+
+    return nrf_gpio_pin_read(m_cfg.grant_cfg.gpio_pin) == m_cfg.grant_cfg.active_high;
+}
+
+/** Set REQUEST and optionally PRIORITY pin to the active level. */
+static void lines_raise(bool high_priority)
+{
+    if (m_cfg.priority_cfg.enable)
+    {
+        nrf_gpiote_task_force(m_cfg.priority_gpiote_ch_id,
+                              (nrf_gpiote_outinit_t)(high_priority ==
+                                                     m_cfg.priority_cfg.active_high));
+    }
+
+    nrf_gpiote_task_force(m_cfg.request_gpiote_ch_id,
+                          (nrf_gpiote_outinit_t)m_cfg.request_cfg.active_high);
+}
+
+/**
+ * @section GPIO control.
+ */
+
+/** Initialize GPIO according to configuration provided. */
+static void gpio_init(void)
+{
+    nrf_gpio_cfg_output(m_cfg.request_cfg.gpio_pin);
+    nrf_gpio_pin_write(m_cfg.request_cfg.gpio_pin, !m_cfg.request_cfg.active_high);
+
+    if (m_cfg.priority_cfg.enable)
+    {
+        nrf_gpio_cfg_output(m_cfg.priority_cfg.gpio_pin);
+        nrf_gpio_pin_write(m_cfg.priority_cfg.gpio_pin, !m_cfg.priority_cfg.active_high);
+    }
+
+    if (m_cfg.grant_cfg.enable)
+    {
+        nrf_gpio_cfg_input(m_cfg.grant_cfg.gpio_pin, NRF_GPIO_PIN_NOPULL);
+    }
+}
+
+/** Configure GPIOTE module. */
+static void gpiote_configure(void)
+{
+    nrf_gpiote_task_configure(m_cfg.request_gpiote_ch_id,
+                              m_cfg.request_cfg.gpio_pin,
+                              (nrf_gpiote_polarity_t)GPIOTE_CONFIG_POLARITY_None,
+                              (nrf_gpiote_outinit_t)!m_cfg.request_cfg.active_high);
+
+    nrf_gpiote_task_enable(m_cfg.request_gpiote_ch_id);
+
+    if (m_cfg.priority_cfg.enable)
+    {
+        nrf_gpiote_task_configure(m_cfg.priority_gpiote_ch_id,
+                                  m_cfg.priority_cfg.gpio_pin,
+                                  (nrf_gpiote_polarity_t)GPIOTE_CONFIG_POLARITY_None,
+                                  (nrf_gpiote_outinit_t)!m_cfg.priority_cfg.active_high);
+
+        nrf_gpiote_task_enable(m_cfg.priority_gpiote_ch_id);
+    }
+}
+
+/**
+ * @section PPI control.
+ */
+
+/** Initialize PPI according to configuration provided. */
+static void ppi_init(void)
+{
+    /* RADIO DISABLED --> clr REQUEST & clr PRIORITY PPI */
+    nrf_ppi_channel_and_fork_endpoint_setup(
+        (nrf_ppi_channel_t)m_cfg.ppi_ch_id_clr,
+        (uint32_t)(&NRF_RADIO->EVENTS_DISABLED),
+        gpiote_task_address_get(&m_cfg.request_cfg, m_cfg.request_gpiote_ch_id, false),
+        m_cfg.priority_cfg.enable ?
+            gpiote_task_address_get(&m_cfg.priority_cfg, m_cfg.priority_gpiote_ch_id, false) :
+            0);
+}
+
+/**
+ * @section PTA API functions.
+ */
+
+void nrf_coex_control_cfg_set(const nrf_coex_control_cfg_t * p_cfg)
+{
+    m_cfg = *p_cfg;
+
+    if (m_cfg.request_cfg.enable)
+    {
+        gpio_init();
+        gpiote_configure();
+        ppi_init();
+    }
+}
+
+void nrf_coex_control_cfg_get(nrf_coex_control_cfg_t * p_cfg)
+{
+    *p_cfg = m_cfg;
+}
+
+uint32_t nrf_coex_control_tx_delay_get(void)
+{
+    if (!m_cfg.request_cfg.enable)
+    {
+        return 0;
+    }
+
+    return (m_cfg.request_to_grant_time_us != 0) ?
+           m_cfg.request_to_grant_time_us : NRF_COEX_CONTROL_DEFAULT_REQUEST_TO_GRANT_TIME;
+}
+
+void nrf_coex_control_tx_request_ppi_setup(nrf_ppi_channel_t ppi_channel)
+{
+    if (!m_cfg.request_cfg.enable)
+    {
+        return;
+    }
+
+    m_stats.tx_requested++;
+
+    // The radio is disabled before ramp-up. Keep the lines raised until the transmission ends.
+    nrf_ppi_channel_disable((nrf_ppi_channel_t)m_cfg.ppi_ch_id_clr);
+
+    if (m_cfg.priority_cfg.enable)
+    {
+        nrf_gpiote_task_force(m_cfg.priority_gpiote_ch_id,
+                              (nrf_gpiote_outinit_t)(m_cfg.tx_high_priority ==
+                                                     m_cfg.priority_cfg.active_high));
+    }
+
+    nrf_ppi_fork_endpoint_setup(ppi_channel,
+                                gpiote_task_address_get(&m_cfg.request_cfg,
+                                                        m_cfg.request_gpiote_ch_id,
+                                                        true));
+}
+
+NRF_802154_RAM_CODE
+bool nrf_coex_control_tx_grant_check(void)
+{
+    if (!m_cfg.request_cfg.enable)
+    {
+        return true;
+    }
+
+    if (!grant_is_active())
+    {
+        m_stats.tx_denied++;
+        nrf_coex_control_release();
+
+        return false;
+    }
+
+    return true;
+}
+
+NRF_802154_RAM_CODE
+void nrf_coex_control_ack_request(void)
+{
+    if (!m_cfg.request_cfg.enable)
+    {
+        return;
+    }
+
+    m_stats.ack_requested++;
+
+    lines_raise(true);
+
+    if (!grant_is_active())
+    {
+        m_stats.ack_denied++;
+    }
+
+    nrf_ppi_channel_enable((nrf_ppi_channel_t)m_cfg.ppi_ch_id_clr);
+}
+
+void nrf_coex_control_release(void)
+{
+    if (!m_cfg.request_cfg.enable)
+    {
+        return;
+    }
+
+    nrf_ppi_channel_disable((nrf_ppi_channel_t)m_cfg.ppi_ch_id_clr);
+
+    nrf_gpiote_task_force(m_cfg.request_gpiote_ch_id,
+                          (nrf_gpiote_outinit_t)!m_cfg.request_cfg.active_high);
+
+    if (m_cfg.priority_cfg.enable)
+    {
+        nrf_gpiote_task_force(m_cfg.priority_gpiote_ch_id,
+                              (nrf_gpiote_outinit_t)!m_cfg.priority_cfg.active_high);
+    }
+}
+
+void nrf_coex_control_stats_get(nrf_coex_control_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+}
+
+void nrf_coex_control_stats_reset(void)
+{
+    m_stats = (nrf_coex_control_stats_t){0};
+}
+
+#endif // NRF_802154_COEX_ENABLED
@@ -0,0 +1,216 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Packet traffic arbitration (PTA) control for the nRF 802.15.4 radio driver.
+ *
+ */
+
+#ifndef NRF_COEX_CONTROL_API_H_
+#define NRF_COEX_CONTROL_API_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nrf_802154_config.h"
+#include "hal/nrf_ppi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @section Resource configuration.
+ */
+
+/** Default REQUEST pin. */
+#define NRF_COEX_CONTROL_DEFAULT_REQUEST_PIN                29
+
+/** Default PRIORITY pin. */
+#define NRF_COEX_CONTROL_DEFAULT_PRIORITY_PIN               30
+
+/** Default GRANT pin. */
+#define NRF_COEX_CONTROL_DEFAULT_GRANT_PIN                  31
+
+/** Default GPIOTE channel for REQUEST pin control. */
+#define NRF_COEX_CONTROL_DEFAULT_REQUEST_GPIOTE_CHANNEL     4
+
+/** Default GPIOTE channel for PRIORITY pin control. */
+#define NRF_COEX_CONTROL_DEFAULT_PRIORITY_GPIOTE_CHANNEL    5
+
+/** Default PPI channel for releasing the medium. */
+#define NRF_COEX_CONTROL_DEFAULT_CLR_PPI_CHANNEL            16
+
+/** Default time in us between raising REQUEST and the radio ramp-up of a frame. */
+#define NRF_COEX_CONTROL_DEFAULT_REQUEST_TO_GRANT_TIME      20
+
+#if NRF_802154_COEX_ENABLED
+
+/**
+ * @brief Configuration parameters for a PTA pin.
+ */
+typedef struct
+{
+     uint8_t enable :1;         /**< Enable this pin */
+     uint8_t active_high :1;    /**< Set the pin to be active high */
+     uint8_t gpio_pin :6;       /**< The GPIO pin */
+} nrf_coex_control_pin_cfg_t;
+
+/**
+ * @brief PTA configuration
+ *
+ * This option configures the nRF 802.15.4 radio driver to arbitrate the 2.4 GHz medium with a
+ * co-located radio, for example a Wi-Fi chip.
+ *
+ * For a frame, the driver raises REQUEST through PPI when the TIMER that schedules the ramp-up
+ * starts. The radio ramps up on a TIMER compare @c request_to_grant_time_us later, and GRANT is
+ * sampled at that moment. If CCA is performed before the frame, GRANT is sampled when CCA reports
+ * idle channel and the transmitter ramps up. A frame for which the medium is denied is not
+ * transmitted and its failure is reported with @ref NRF_802154_TX_ERROR_COEX_DENIED.
+ *
+ * For an ACK frame, REQUEST and PRIORITY are raised when the ACK frame is armed, which precedes
+ * its ramp-up by the turnaround time. The lines are released by a PPI channel on the RADIO
+ * DISABLED event after an ACK frame, or by the driver when a transmission ends. The GPIOTE and
+ * PPI channels are provided by the application and should be regarded as reserved as long as
+ * the arbitration is enabled.
+ *
+ * @note Changing this configuration while the radio is in use may have undefined
+ *       consequences and must be avoided by the application.
+ */
+typedef struct
+{
+    nrf_coex_control_pin_cfg_t request_cfg;           /**< REQUEST pin configuration */
+    nrf_coex_control_pin_cfg_t priority_cfg;          /**< PRIORITY pin configuration */
+    nrf_coex_control_pin_cfg_t grant_cfg;             /**< GRANT pin configuration */
+    uint8_t                    request_gpiote_ch_id;  /**< GPIOTE channel used for REQUEST pin toggling */
+    uint8_t                    priority_gpiote_ch_id; /**< GPIOTE channel used for PRIORITY pin toggling */
+    uint8_t                    ppi_ch_id_clr;         /**< PPI channel used for releasing the medium after an ACK frame */
+    bool                       tx_high_priority;      /**< If PRIORITY is raised also for frames other than ACK */
+    uint8_t                    request_to_grant_time_us; /**< Time in us between raising REQUEST and the ramp-up of a frame, in which the arbiter shall respond on GRANT pin. 0 selects @ref NRF_COEX_CONTROL_DEFAULT_REQUEST_TO_GRANT_TIME */
+} nrf_coex_control_cfg_t;
+
+/**
+ * @brief Statistics of the arbitration.
+ */
+typedef struct
+{
+    uint32_t tx_requested;  /**< Number of frames for which the medium was requested */
+    uint32_t tx_denied;     /**< Number of frames not transmitted because the medium was denied */
+    uint32_t ack_requested; /**< Number of ACK frames for which the medium was requested */
+    uint32_t ack_denied;    /**< Number of ACK frames transmitted although the medium was denied */
+} nrf_coex_control_stats_t;
+
+/**@brief Set PTA configuration.
+ *
+ * @note This function shall not be called when radio is in use.
+ *
+ * @param[in] p_cfg A pointer to the PTA configuration.
+ *
+ */
+void nrf_coex_control_cfg_set(const nrf_coex_control_cfg_t * p_cfg);
+
+/**@brief Get PTA configuration.
+ *
+ * @param[out] p_cfg A pointer to the structure for the PTA configuration.
+ *
+ */
+void nrf_coex_control_cfg_get(nrf_coex_control_cfg_t * p_cfg);
+
+/**@brief Get delay of the ramp-up of a frame after REQUEST pin is raised.
+ *
+ * @returns Delay in us, or 0 if the arbitration is disabled and the ramp-up shall not be delayed.
+ */
+uint32_t nrf_coex_control_tx_delay_get(void);
+
+/**@brief Configure PPI to request the medium for transmission of a frame.
+ *
+ * PRIORITY pin is set according to the configuration. REQUEST pin is raised by the fork of
+ * the given PPI channel, which shall be triggered @ref nrf_coex_control_tx_delay_get before
+ * the radio ramps up.
+ *
+ * @param[in] ppi_channel PPI channel which fork raises REQUEST pin.
+ *
+ */
+void nrf_coex_control_tx_request_ppi_setup(nrf_ppi_channel_t ppi_channel);
+
+/**@brief Check if the medium is granted for transmission of a frame.
+ *
+ * This function shall be called when the radio ramps up for the frame. If the medium is denied,
+ * REQUEST pin is released immediately.
+ *
+ * @retval true   The medium is granted or the arbitration is disabled.
+ * @retval false  The medium is denied.
+ */
+bool nrf_coex_control_tx_grant_check(void);
+
+/**@brief Request the medium for transmission of an ACK frame.
+ *
+ * REQUEST and PRIORITY pins are raised and released by PPI when the radio is disabled after
+ * the ACK frame. The ACK frame is transmitted even if the medium is denied, as the peer would
+ * retransmit the frame otherwise.
+ */
+void nrf_coex_control_ack_request(void);
+
+/**@brief Release the medium immediately.
+ *
+ */
+void nrf_coex_control_release(void);
+
+/**@brief Get statistics of the arbitration.
+ *
+ * @param[out] p_stats A pointer to the structure for the statistics.
+ *
+ */
+void nrf_coex_control_stats_get(nrf_coex_control_stats_t * p_stats);
+
+/**@brief Reset statistics of the arbitration.
+ *
+ */
+void nrf_coex_control_stats_reset(void);
+
+#else  // NRF_802154_COEX_ENABLED
+
+#define nrf_coex_control_cfg_set(...)
+#define nrf_coex_control_cfg_get(...)
+#define nrf_coex_control_tx_delay_get(...) 0
+#define nrf_coex_control_tx_request_ppi_setup(...)
+#define nrf_coex_control_tx_grant_check(...) true
+#define nrf_coex_control_ack_request(...)
+#define nrf_coex_control_release(...)
+#define nrf_coex_control_stats_get(...)
+#define nrf_coex_control_stats_reset(...)
+
+#endif // NRF_802154_COEX_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_COEX_CONTROL_API_H_ */
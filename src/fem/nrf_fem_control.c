@@ -74,6 +74,27 @@ static bool pin_is_enabled(nrf_fem_control_pin_t pin)
     }
 }
 
+/** Get time in us when given pin is activated before radio is ready. */
+static uint32_t time_in_advance_get(nrf_fem_control_pin_t pin)
+{
+    uint32_t time_in_advance;
+
+    switch (pin)
+    {
+        case NRF_FEM_CONTROL_LNA_PIN:
+            time_in_advance = m_nrf_fem_control_cfg.lna_time_in_advance_us;
+            return (time_in_advance != 0) ? time_in_advance : NRF_FEM_LNA_TIME_IN_ADVANCE;
+
+        case NRF_FEM_CONTROL_PA_PIN:
+            time_in_advance = m_nrf_fem_control_cfg.pa_time_in_advance_us;
+            return (time_in_advance != 0) ? time_in_advance : NRF_FEM_PA_TIME_IN_ADVANCE;
+
+        default:
+            assert(false);
+            return 0;
+    }
+}
+
 /**
  * @section GPIO control.
  */
@@ -96,6 +117,17 @@ static void gpio_init(void)
     }
 }
 
+/** Initialize power-down GPIO according to configuration provided. FEM is left powered down. */
+static void gpio_pdn_init(void)
+{
+    if (m_nrf_fem_control_cfg.pdn_cfg.enable)
+    {
+        nrf_gpio_cfg_output(m_nrf_fem_control_cfg.pdn_cfg.gpio_pin);
+        nrf_gpio_pin_write(m_nrf_fem_control_cfg.pdn_cfg.gpio_pin,
+                           !m_nrf_fem_control_cfg.pdn_cfg.active_high);
+    }
+}
+
 /** Configure GPIOTE module. */
 static void gpiote_configure(void)
 {
@@ -173,6 +205,20 @@ void nrf_fem_control_cfg_set(const nrf_fem_control_cfg_t * p_cfg)
 
         nrf_ppi_channel_enable((nrf_ppi_channel_t)m_nrf_fem_control_cfg.ppi_ch_id_clr);
     }
+
+    if (m_nrf_fem_control_cfg.pdn_cfg.enable)
+    {
+        // FEM is powered up before the radio ramp-up is triggered. Amplifiers activated on
+        // the ramp-up timer must not be activated before the FEM settles.
+        assert(!pin_is_enabled(NRF_FEM_CONTROL_PA_PIN) ||
+               (nrf_fem_control_delay_get(NRF_FEM_CONTROL_PA_PIN) >=
+                m_nrf_fem_control_cfg.pdn_settle_time_us));
+        assert(!pin_is_enabled(NRF_FEM_CONTROL_LNA_PIN) ||
+               (nrf_fem_control_delay_get(NRF_FEM_CONTROL_LNA_PIN) >=
+                m_nrf_fem_control_cfg.pdn_settle_time_us));
+    }
+
+    gpio_pdn_init();
 }
 
 void nrf_fem_control_cfg_get(nrf_fem_control_cfg_t * p_cfg)
@@ -197,6 +243,24 @@ void nrf_fem_control_deactivate(void)
     }
 }
 
+void nrf_fem_control_power_up(void)
+{
+    if (m_nrf_fem_control_cfg.pdn_cfg.enable)
+    {
+        nrf_gpio_pin_write(m_nrf_fem_control_cfg.pdn_cfg.gpio_pin,
+                           m_nrf_fem_control_cfg.pdn_cfg.active_high);
+    }
+}
+
+void nrf_fem_control_power_down(void)
+{
+    if (m_nrf_fem_control_cfg.pdn_cfg.enable)
+    {
+        nrf_gpio_pin_write(m_nrf_fem_control_cfg.pdn_cfg.gpio_pin,
+                           !m_nrf_fem_control_cfg.pdn_cfg.active_high);
+    }
+}
+
 void nrf_fem_control_ppi_enable(nrf_fem_control_pin_t pin, nrf_timer_cc_channel_t timer_cc_channel)
 {
     if (pin_is_enabled(pin))
@@ -234,14 +298,18 @@ uint32_t nrf_fem_control_delay_get(nrf_fem_control_pin_t pin)
 
     if (pin_is_enabled(pin))
     {
+        uint32_t time_in_advance = time_in_advance_get(pin);
+
         switch (pin)
         {
             case NRF_FEM_CONTROL_LNA_PIN:
-                target_time = NRF_FEM_RADIO_RX_STARTUP_LATENCY_US - NRF_FEM_LNA_TIME_IN_ADVANCE;
+                assert(time_in_advance < NRF_FEM_RADIO_RX_STARTUP_LATENCY_US);
+                target_time = NRF_FEM_RADIO_RX_STARTUP_LATENCY_US - time_in_advance;
                 break;
 
             case NRF_FEM_CONTROL_PA_PIN:
-                target_time = NRF_FEM_RADIO_TX_STARTUP_LATENCY_US - NRF_FEM_PA_TIME_IN_ADVANCE;
+                assert(time_in_advance < NRF_FEM_RADIO_TX_STARTUP_LATENCY_US);
+                target_time = NRF_FEM_RADIO_TX_STARTUP_LATENCY_US - time_in_advance;
                 break;
 
             default:
@@ -56,6 +56,9 @@ extern "C" {
 /** Default Low Noise Amplifier pin. */
 #define NRF_FEM_CONTROL_DEFAULT_LNA_PIN                     27
 
+/** Default power-down pin. */
+#define NRF_FEM_CONTROL_DEFAULT_PDN_PIN                     28
+
 /** Default PPI channel for pin setting. */
 #define NRF_FEM_CONTROL_DEFAULT_SET_PPI_CHANNEL             18
 
@@ -89,17 +92,24 @@ typedef struct
  * Toggling the pins is achieved by using two PPI channels and a GPIOTE channel. The hardware channel IDs are provided
  * by the application and should be regarded as reserved as long as any PA/LNA toggling is enabled.
  *
+ * The optional power-down pin is driven directly by the CPU. The FEM is powered up when the radio
+ * wakes up and powered down when the radio goes to sleep.
+ *
  * @note Changing this configuration while the radio is in use may have undefined
  *       consequences and must be avoided by the application.
  */
 typedef struct
 {
-    nrf_fem_control_pa_lna_cfg_t pa_cfg;            /**< Power Amplifier configuration */
-    nrf_fem_control_pa_lna_cfg_t lna_cfg;           /**< Low Noise Amplifier configuration */
-    uint8_t                      pa_gpiote_ch_id;   /**< GPIOTE channel used for Power Amplifier pin toggling */
-    uint8_t                      lna_gpiote_ch_id;  /**< GPIOTE channel used for Low Noise Amplifier pin toggling */
-    uint8_t                      ppi_ch_id_set;     /**< PPI channel used for radio Power Amplifier and Low Noise Amplifier pins setting */
-    uint8_t                      ppi_ch_id_clr;     /**< PPI channel used for radio pin clearing */
+    nrf_fem_control_pa_lna_cfg_t pa_cfg;                 /**< Power Amplifier configuration */
+    nrf_fem_control_pa_lna_cfg_t lna_cfg;                /**< Low Noise Amplifier configuration */
+    uint8_t                      pa_gpiote_ch_id;        /**< GPIOTE channel used for Power Amplifier pin toggling */
+    uint8_t                      lna_gpiote_ch_id;       /**< GPIOTE channel used for Low Noise Amplifier pin toggling */
+    uint8_t                      ppi_ch_id_set;          /**< PPI channel used for radio Power Amplifier and Low Noise Amplifier pins setting */
+    uint8_t                      ppi_ch_id_clr;          /**< PPI channel used for radio pin clearing */
+    nrf_fem_control_pa_lna_cfg_t pdn_cfg;                /**< Power-down pin configuration. The pin is active when the FEM is powered up */
+    uint8_t                      pa_time_in_advance_us;  /**< Time in us when PA pin is activated before radio is ready for transmission. 0 selects @ref NRF_FEM_PA_TIME_IN_ADVANCE */
+    uint8_t                      lna_time_in_advance_us; /**< Time in us when LNA pin is activated before radio is ready for reception. 0 selects @ref NRF_FEM_LNA_TIME_IN_ADVANCE */
+    uint8_t                      pdn_settle_time_us;     /**< Time in us needed by the FEM to settle after power-up. It shall not exceed the delay of PA and LNA activation after the ramp-up is triggered */
 } nrf_fem_control_cfg_t;
 
 /**
@@ -140,6 +150,20 @@ void nrf_fem_control_activate(void);
  */
 void nrf_fem_control_deactivate(void);
 
+/**@brief Power up the Front End Module.
+ *
+ * This function should be called before the radio ramp-up is triggered for reception or
+ * transmission. The configuration shall let the FEM settle before PA or LNA pin is activated,
+ * that is @c pdn_settle_time_us shall not exceed the delay of the enabled pins.
+ */
+void nrf_fem_control_power_up(void);
+
+/**@brief Power down the Front End Module.
+ *
+ * This function should be called when radio goes to sleep.
+ */
+void nrf_fem_control_power_down(void);
+
 /**@brief Configure PPI to activate one of the Front End Module pins on an appropriate timer event.
  * 
  * @param[in] pin              The Front End Module controlled pin to be connected to the PPI.
@@ -240,6 +264,8 @@ void nrf_fem_control_ppi_pin_task_setup(nrf_ppi_channel_t ppi_channel,
 #define nrf_fem_control_cfg_get(...)
 #define nrf_fem_control_activate(...)
 #define nrf_fem_control_deactivate(...)
+#define nrf_fem_control_power_up(...)
+#define nrf_fem_control_power_down(...)
 #define nrf_fem_control_ppi_enable(...)
 #define nrf_fem_control_ppi_disable(...)
 #define nrf_fem_control_delay_get(...)   1
@@ -45,6 +45,9 @@ extern "C" {
 /** Time in us when LNA GPIO is activated before radio is ready for reception. */
 #define NRF_FEM_LNA_TIME_IN_ADVANCE         5
 
+/** Time in us needed by the FEM to settle after PDN GPIO powers it up. */
+#define NRF_FEM_PDN_SETTLE_TIME             10
+
 #ifdef NRF52840_XXAA
 
 /** Radio ramp-up time in TX mode, in us. */
@@ -250,6 +250,13 @@ __STATIC_INLINE void nrf_radio_int_disable(uint32_t radio_int_mask);
  */
 __STATIC_INLINE bool nrf_radio_int_get(nrf_radio_int_mask_t radio_int_mask);
 
+/**
+ * @brief Function for getting the mask of all enabled interrupts.
+ *
+ * @return     Mask of enabled interrupts.
+ */
+__STATIC_INLINE uint32_t nrf_radio_int_enable_get(void);
+
 /**
  * @brief Function for getting the address of a specific task.
  *
@@ -554,6 +561,11 @@ __STATIC_INLINE bool nrf_radio_int_get(nrf_radio_int_mask_t radio_int_mask)
     return (bool)(NRF_RADIO->INTENCLR & radio_int_mask);
 }
 
+__STATIC_INLINE uint32_t nrf_radio_int_enable_get(void)
+{
+    return NRF_RADIO->INTENCLR;
+}
+
 __STATIC_INLINE uint32_t *nrf_radio_task_address_get(nrf_radio_task_t radio_task)
 {
     return (uint32_t *)((uint8_t *)NRF_RADIO + radio_task);
@@ -40,19 +40,31 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_tx_desc.h"
+#include "nrf_802154_utils.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
+#if NRF_802154_ACK_TIMEOUT_ENABLED
+
 #define RETRY_DELAY     500      ///< Procedure is delayed by this time if cannot be performed at the moment.
 #define MAX_RETRY_DELAY 1000000  ///< Maximal allowed delay of procedure retry.
 
 static void timeout_timer_retry(void);
 
-static uint32_t           m_timeout = NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT;  ///< ACK timeout in us.
-static nrf_802154_timer_t m_timer;                                             ///< Timer used to notify when we are waiting too long for ACK.
-static volatile bool      m_procedure_is_active;
-static const uint8_t    * mp_frame;
+static uint32_t           NRF_802154_PER_INSTANCE(m_timeout) = NRF_802154_PER_INSTANCE_INIT(NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT); ///< ACK timeout in us.
+static nrf_802154_timer_t NRF_802154_PER_INSTANCE(m_timer);                                                                          ///< Timer used to notify when we are waiting too long for ACK.
+static volatile bool      NRF_802154_PER_INSTANCE(m_procedure_is_active);
+static volatile bool      NRF_802154_PER_INSTANCE(m_sleep_is_pending);                                                               ///< Indicates if the receiver enabled after NO_ACK should be disabled.
+static const uint8_t    * NRF_802154_PER_INSTANCE(mp_frame);
+#define m_timeout             NRF_802154_INSTANCE_OF(m_timeout)
+#define m_timer               NRF_802154_INSTANCE_OF(m_timer)
+#define m_procedure_is_active NRF_802154_INSTANCE_OF(m_procedure_is_active)
+#define m_sleep_is_pending    NRF_802154_INSTANCE_OF(m_sleep_is_pending)
+#define mp_frame              NRF_802154_INSTANCE_OF(mp_frame)
 
 static void notify_tx_error(bool result)
 {
@@ -62,6 +74,46 @@ static void notify_tx_error(bool result)
     }
 }
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
+static void sleep_timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    if (m_sleep_is_pending)
+    {
+        // Mark procedure as stopped before the request to ignore abort hook called by this request.
+        m_sleep_is_pending = false;
+
+        if (!nrf_802154_request_sleep(NRF_802154_TERM_NONE))
+        {
+            // Frame is being received. Try again later.
+            m_sleep_is_pending = true;
+            timeout_timer_retry();
+        }
+    }
+}
+
+/**
+ * @brief Disable receiver enabled after NO_ACK when receiver is disabled when idle.
+ *
+ * Receiver is kept enabled for the receive window after transmission, as after any other failed
+ * transmission.
+ */
+static void sleep_timer_start(void)
+{
+    m_timer.callback  = sleep_timer_fired;
+    m_timer.p_context = NULL;
+    m_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_timer.dt        = nrf_802154_pib_rx_window_after_tx_get();
+
+    m_sleep_is_pending = true;
+
+    nrf_802154_timer_sched_add(&m_timer, true);
+}
+
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
 static void timeout_timer_fired(void * p_context)
 {
     (void)p_context;
@@ -74,6 +126,14 @@ static void timeout_timer_fired(void * p_context)
                                        false))
         {
             m_procedure_is_active = false;
+
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+            if (!nrf_802154_pib_rx_on_when_idle_get())
+            {
+                // Receiver should not stay enabled after failed transmission.
+                sleep_timer_start();
+            }
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
         }
         else
         {
@@ -90,12 +150,12 @@ static void timeout_timer_retry(void)
     nrf_802154_timer_sched_add(&m_timer, true);
 }
 
-static void timeout_timer_start(void)
+static void timeout_timer_start(uint32_t timeout)
 {
     m_timer.callback  = timeout_timer_fired;
     m_timer.p_context = NULL;
     m_timer.t0        = nrf_802154_timer_sched_time_get();
-    m_timer.dt        = m_timeout;
+    m_timer.dt        = timeout;
 
     m_procedure_is_active = true;
 
@@ -105,6 +165,7 @@ static void timeout_timer_start(void)
 static void timeout_timer_stop(void)
 {
     m_procedure_is_active = false;
+    m_sleep_is_pending    = false;
 
     // To make sure `timeout_timer_fired()` detects that procedure is being stopped if it preempts
     // this function.
@@ -120,8 +181,19 @@ void nrf_802154_ack_timeout_time_set(uint32_t time)
 
 bool nrf_802154_ack_timeout_tx_started_hook(const uint8_t * p_frame)
 {
+    uint32_t timeout = m_timeout;
+
+#if NRF_802154_TX_EX_ENABLED
+    const nrf_802154_tx_desc_t * p_desc = nrf_802154_tx_desc_get(p_frame);
+
+    if ((p_desc != NULL) && (p_desc->flags & NRF_802154_TX_DESC_ACK_TIMEOUT))
+    {
+        timeout = p_desc->ack_timeout;
+    }
+#endif // NRF_802154_TX_EX_ENABLED
+
     mp_frame = p_frame;
-    timeout_timer_start();
+    timeout_timer_start(timeout);
 
     return true;
 }
@@ -130,6 +202,12 @@ bool nrf_802154_ack_timeout_abort(nrf_802154_term_t term_lvl, req_originator_t r
 {
     bool result;
 
+    if (m_sleep_is_pending && (req_orig != REQ_ORIG_ACK_TIMEOUT) && (req_orig != REQ_ORIG_RSCH))
+    {
+        // Any request changing radio state cancels disabling of the receiver.
+        timeout_timer_stop();
+    }
+
     if (!m_procedure_is_active || req_orig == REQ_ORIG_ACK_TIMEOUT)
     {
         // Ignore if procedure is not running or self-request.
@@ -166,3 +244,5 @@ bool nrf_802154_ack_timeout_tx_failed_hook(const uint8_t * p_frame, nrf_802154_t
 
     return true;
 }
+
+#endif // NRF_802154_ACK_TIMEOUT_ENABLED
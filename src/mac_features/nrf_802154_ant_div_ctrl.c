@@ -0,0 +1,406 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements antenna diversity for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_ant_div_ctrl.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_neighbor.h"
+#include "nrf_802154_utils.h"
+#include "hal/nrf_gpio.h"
+
+#if NRF_802154_ANT_DIV_ENABLED
+
+#define RSSI_AVG_SHIFT 2 ///< Weight of the last RSSI sample in the average is 1 / (2 ^ RSSI_AVG_SHIFT).
+
+typedef struct
+{
+    nrf_802154_neighbor_id_t     id;         ///< Identity of the neighbor. Shall be the first member.
+    nrf_802154_ant_div_antenna_t antenna;    ///< Antenna used to transmit frames to the neighbor.
+    uint32_t                     last_heard; ///< Value of @ref m_frames_count when the neighbor was last heard.
+} neighbor_t;
+
+static nrf_802154_ant_div_cfg_t      NRF_802154_PER_INSTANCE(m_cfg);                                     ///< Antenna select pin configuration.
+static nrf_802154_ant_div_stats_t    NRF_802154_PER_INSTANCE(m_stats);                                   ///< Statistics of antenna selection.
+static neighbor_t                    NRF_802154_PER_INSTANCE(m_neighbors)[NRF_802154_ANT_DIV_NEIGHBORS]; ///< Antennas preferred by neighbors.
+static int16_t                       NRF_802154_PER_INSTANCE(m_rssi_avg)[NRF_802154_ANT_DIV_ANTENNAS];   ///< Average RSSI of each antenna, scaled by 2 ^ RSSI_AVG_SHIFT.
+static bool                          NRF_802154_PER_INSTANCE(m_rssi_valid)[NRF_802154_ANT_DIV_ANTENNAS]; ///< If the average RSSI of each antenna was measured.
+static uint32_t                      NRF_802154_PER_INSTANCE(m_frames_count);                            ///< Number of received frames used to age neighbors.
+static uint8_t                       NRF_802154_PER_INSTANCE(m_explore_count);                           ///< Number of receptions with the preferred antenna in row.
+static nrf_802154_ant_div_antenna_t  NRF_802154_PER_INSTANCE(m_antenna);                                 ///< Currently selected antenna.
+static nrf_802154_neighbor_pending_t NRF_802154_PER_INSTANCE(m_pending);                                 ///< Frame waiting for ACK.
+static nrf_802154_ant_div_antenna_t  NRF_802154_PER_INSTANCE(m_pending_antenna);                         ///< Antenna the pending frame is sent with.
+#define m_cfg             NRF_802154_INSTANCE_OF(m_cfg)
+#define m_stats           NRF_802154_INSTANCE_OF(m_stats)
+#define m_neighbors       NRF_802154_INSTANCE_OF(m_neighbors)
+#define m_rssi_avg        NRF_802154_INSTANCE_OF(m_rssi_avg)
+#define m_rssi_valid      NRF_802154_INSTANCE_OF(m_rssi_valid)
+#define m_frames_count    NRF_802154_INSTANCE_OF(m_frames_count)
+#define m_explore_count   NRF_802154_INSTANCE_OF(m_explore_count)
+#define m_antenna         NRF_802154_INSTANCE_OF(m_antenna)
+#define m_pending         NRF_802154_INSTANCE_OF(m_pending)
+#define m_pending_antenna NRF_802154_INSTANCE_OF(m_pending_antenna)
+
+/**
+ * @brief Find a neighbor.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor.
+ * @param[in]  extended  If the given address is extended.
+ *
+ * @return  Pointer to the neighbor or NULL if it is not known.
+ */
+static neighbor_t * neighbor_find(const uint8_t * p_addr, bool extended)
+{
+    return nrf_802154_neighbor_find(m_neighbors,
+                                    sizeof(m_neighbors[0]),
+                                    NRF_802154_ANT_DIV_NEIGHBORS,
+                                    p_addr,
+                                    extended);
+}
+
+/**
+ * @brief Find a neighbor or add it in place of a free or the least recently heard entry.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor.
+ * @param[in]  extended  If the given address is extended.
+ *
+ * @return  Pointer to the neighbor.
+ */
+static neighbor_t * neighbor_learn(const uint8_t * p_addr, bool extended)
+{
+    neighbor_t * p_neighbor = neighbor_find(p_addr, extended);
+    uint8_t      index      = 0;
+
+    if (p_neighbor != NULL)
+    {
+        return p_neighbor;
+    }
+
+    for (uint8_t i = 0; i < NRF_802154_ANT_DIV_NEIGHBORS; i++)
+    {
+        if (!m_neighbors[i].id.in_use)
+        {
+            index = i;
+            break;
+        }
+
+        if ((m_frames_count - m_neighbors[i].last_heard) >
+            (m_frames_count - m_neighbors[index].last_heard))
+        {
+            index = i;
+        }
+    }
+
+    p_neighbor = &m_neighbors[index];
+
+    memset(p_neighbor, 0, sizeof(*p_neighbor));
+    nrf_802154_neighbor_id_set(&p_neighbor->id, p_addr, extended);
+    p_neighbor->last_heard = m_frames_count;
+
+    return p_neighbor;
+}
+
+/** Get the other antenna. */
+static nrf_802154_ant_div_antenna_t antenna_other(nrf_802154_ant_div_antenna_t antenna)
+{
+    return (antenna == NRF_802154_ANT_DIV_ANTENNA_1) ?
+           NRF_802154_ANT_DIV_ANTENNA_2 : NRF_802154_ANT_DIV_ANTENNA_1;
+}
+
+/** Get the antenna with better average RSSI of received frames. */
+static nrf_802154_ant_div_antenna_t antenna_preferred_get(void)
+{
+    if (!m_rssi_valid[NRF_802154_ANT_DIV_ANTENNA_1])
+    {
+        return NRF_802154_ANT_DIV_ANTENNA_1;
+    }
+
+    if (!m_rssi_valid[NRF_802154_ANT_DIV_ANTENNA_2])
+    {
+        return NRF_802154_ANT_DIV_ANTENNA_2;
+    }
+
+    return (m_rssi_avg[NRF_802154_ANT_DIV_ANTENNA_2] > m_rssi_avg[NRF_802154_ANT_DIV_ANTENNA_1]) ?
+           NRF_802154_ANT_DIV_ANTENNA_2 : NRF_802154_ANT_DIV_ANTENNA_1;
+}
+
+/**
+ * @brief Get the antenna used to receive the next frame.
+ *
+ * The preferred antenna is used, except for every @ref NRF_802154_ANT_DIV_EXPLORE_PERIOD-th
+ * reception that is used to refresh the RSSI estimate of the other antenna.
+ */
+static nrf_802154_ant_div_antenna_t rx_antenna_get(void)
+{
+    nrf_802154_ant_div_antenna_t antenna = antenna_preferred_get();
+
+    if (++m_explore_count >= NRF_802154_ANT_DIV_EXPLORE_PERIOD)
+    {
+        m_explore_count = 0;
+        antenna         = antenna_other(antenna);
+    }
+
+    return antenna;
+}
+
+/** Drive the antenna select pin to select the given antenna. */
+static void antenna_set(nrf_802154_ant_div_antenna_t antenna)
+{
+    m_antenna = antenna;
+    m_stats.selected_count[antenna]++;
+
+    nrf_gpio_pin_write(m_cfg.gpio_pin, antenna == NRF_802154_ANT_DIV_ANTENNA_2);
+}
+
+/**
+ * @brief Get the neighbor the pending frame was sent to and clear the pending frame.
+ *
+ * A neighbor that is not known yet is learned, so that the result of the transmission selects
+ * the antenna of the next transmission to the neighbor.
+ *
+ * @return  Pointer to the neighbor or NULL if there is no pending frame or it has no destination.
+ */
+static neighbor_t * pending_neighbor_take(void)
+{
+    nrf_802154_neighbor_id_t dst;
+
+    if (!nrf_802154_neighbor_pending_take(&m_pending, &dst))
+    {
+        return NULL;
+    }
+
+    return neighbor_learn(dst.addr, dst.extended);
+}
+
+/** Handle a frame that was transmitted, but not acknowledged. */
+static void ack_missing(void)
+{
+    neighbor_t * p_neighbor = pending_neighbor_take();
+
+    m_stats.tx_count[m_pending_antenna]++;
+
+    // Retransmission of the frame will try the other antenna.
+    if (p_neighbor != NULL)
+    {
+        p_neighbor->antenna = antenna_other(m_pending_antenna);
+    }
+}
+
+void nrf_802154_ant_div_ctrl_cfg_set(const nrf_802154_ant_div_cfg_t * p_cfg)
+{
+    m_cfg = *p_cfg;
+
+    if (m_cfg.enable)
+    {
+        nrf_gpio_cfg_output(m_cfg.gpio_pin);
+        nrf_gpio_pin_write(m_cfg.gpio_pin, m_antenna == NRF_802154_ANT_DIV_ANTENNA_2);
+    }
+}
+
+void nrf_802154_ant_div_ctrl_cfg_get(nrf_802154_ant_div_cfg_t * p_cfg)
+{
+    *p_cfg = m_cfg;
+}
+
+void nrf_802154_ant_div_ctrl_stats_get(nrf_802154_ant_div_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+
+    for (uint8_t i = 0; i < NRF_802154_ANT_DIV_ANTENNAS; i++)
+    {
+        p_stats->rssi[i] = (int8_t)(m_rssi_avg[i] >> RSSI_AVG_SHIFT);
+    }
+}
+
+void nrf_802154_ant_div_ctrl_stats_reset(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+void nrf_802154_ant_div_ctrl_rx_prepare(void)
+{
+    if (m_cfg.enable)
+    {
+        antenna_set(rx_antenna_get());
+    }
+}
+
+void nrf_802154_ant_div_ctrl_tx_prepare(const uint8_t * p_frame)
+{
+    nrf_802154_ant_div_antenna_t antenna    = antenna_preferred_get();
+    neighbor_t                 * p_neighbor = NULL;
+    const uint8_t              * p_dst_addr;
+    bool                         extended;
+
+    if (!m_cfg.enable)
+    {
+        return;
+    }
+
+    // A new transmission replaces the previous one without a result, e.g. when the higher layer
+    // terminated waiting for ACK.
+    nrf_802154_neighbor_pending_clear(&m_pending);
+
+    p_dst_addr = nrf_802154_neighbor_dst_addr_get(p_frame, &extended);
+
+    if (p_dst_addr != NULL)
+    {
+        p_neighbor = neighbor_find(p_dst_addr, extended);
+    }
+
+    if (p_neighbor != NULL)
+    {
+        antenna = p_neighbor->antenna;
+    }
+
+    if (p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT)
+    {
+        nrf_802154_neighbor_pending_set(&m_pending, p_frame);
+        m_pending_antenna = antenna;
+    }
+
+    antenna_set(antenna);
+}
+
+nrf_802154_ant_div_antenna_t nrf_802154_ant_div_ctrl_antenna_get(void)
+{
+    return m_antenna;
+}
+
+void nrf_802154_ant_div_ctrl_frame_received(const uint8_t              * p_psdu,
+                                            int8_t                       rssi,
+                                            nrf_802154_ant_div_antenna_t antenna)
+{
+    const uint8_t * p_src_addr;
+    neighbor_t    * p_neighbor;
+    bool            extended;
+
+    if (!m_cfg.enable)
+    {
+        return;
+    }
+
+    m_frames_count++;
+    m_stats.rx_count[antenna]++;
+
+    if (m_rssi_valid[antenna])
+    {
+        m_rssi_avg[antenna] += (int16_t)rssi - (m_rssi_avg[antenna] >> RSSI_AVG_SHIFT);
+    }
+    else
+    {
+        m_rssi_avg[antenna]   = (int16_t)((int16_t)rssi << RSSI_AVG_SHIFT);
+        m_rssi_valid[antenna] = true;
+    }
+
+    p_src_addr = nrf_802154_neighbor_src_addr_get(p_psdu, &extended);
+
+    if (p_src_addr == NULL)
+    {
+        return;
+    }
+
+    p_neighbor = neighbor_learn(p_src_addr, extended);
+
+    p_neighbor->antenna    = antenna;
+    p_neighbor->last_heard = m_frames_count;
+}
+
+bool nrf_802154_ant_div_ctrl_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    if ((m_pending.p_frame != NULL) && (term_lvl >= NRF_802154_TERM_802154))
+    {
+        if (req_orig == REQ_ORIG_ACK_TIMEOUT)
+        {
+            ack_missing();
+        }
+        else
+        {
+            nrf_802154_neighbor_pending_clear(&m_pending);
+        }
+    }
+
+    return true;
+}
+
+void nrf_802154_ant_div_ctrl_transmitted_hook(const uint8_t * p_frame)
+{
+    neighbor_t * p_neighbor;
+
+    if (p_frame != m_pending.p_frame)
+    {
+        return;
+    }
+
+    p_neighbor = pending_neighbor_take();
+
+    m_stats.tx_count[m_pending_antenna]++;
+    m_stats.ack_count[m_pending_antenna]++;
+
+    if (p_neighbor != NULL)
+    {
+        p_neighbor->antenna = m_pending_antenna;
+    }
+}
+
+bool nrf_802154_ant_div_ctrl_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    if (p_frame != m_pending.p_frame)
+    {
+        return true;
+    }
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+        case NRF_802154_TX_ERROR_NO_ACK:
+            ack_missing();
+            break;
+
+        default:
+            // The frame was not transmitted.
+            nrf_802154_neighbor_pending_clear(&m_pending);
+            break;
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_ANT_DIV_ENABLED
@@ -0,0 +1,149 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_ANT_DIV_CTRL_H__
+#define NRF_802154_ANT_DIV_CTRL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_ant_div_ctrl 802.15.4 driver antenna diversity
+ * @{
+ * @ingroup nrf_802154
+ * @brief Selection of one of two antennas for each reception and transmission.
+ *
+ * The receiver uses the antenna with better average RSSI of received frames and periodically
+ * listens with the other antenna to refresh its estimate. Frames are transmitted with the antenna
+ * that last received a frame from the destination neighbor. If such a frame is not acknowledged,
+ * the other antenna is used for the next attempt.
+ *
+ * The antenna is switched before the radio starts ramping up and between frames received in a row.
+ * ACK frames are transmitted with the antenna that received the frame.
+ */
+
+/**
+ * @brief Set configuration of the antenna select pin.
+ *
+ * @param[in]  p_cfg  Pointer to the configuration.
+ */
+void nrf_802154_ant_div_ctrl_cfg_set(const nrf_802154_ant_div_cfg_t * p_cfg);
+
+/**
+ * @brief Get configuration of the antenna select pin.
+ *
+ * @param[out]  p_cfg  Pointer to the structure filled with the configuration.
+ */
+void nrf_802154_ant_div_ctrl_cfg_get(nrf_802154_ant_div_cfg_t * p_cfg);
+
+/**
+ * @brief Get statistics of antenna selection.
+ *
+ * @param[out]  p_stats  Pointer to the structure filled with the statistics.
+ */
+void nrf_802154_ant_div_ctrl_stats_get(nrf_802154_ant_div_stats_t * p_stats);
+
+/**
+ * @brief Reset statistics of antenna selection. Learned preferences are kept.
+ */
+void nrf_802154_ant_div_ctrl_stats_reset(void);
+
+/**
+ * @brief Select the antenna for the next reception.
+ *
+ * This function is called before the receiver ramps up and while it listens between frames.
+ * It must not be called before the ACK frame to the received frame is transmitted.
+ */
+void nrf_802154_ant_div_ctrl_rx_prepare(void);
+
+/**
+ * @brief Select the antenna for transmission of a frame that is about to start.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU of the frame to transmit.
+ */
+void nrf_802154_ant_div_ctrl_tx_prepare(const uint8_t * p_frame);
+
+/**
+ * @brief Get the currently selected antenna.
+ *
+ * @return  Antenna selected by the most recent preparation of the radio.
+ */
+nrf_802154_ant_div_antenna_t nrf_802154_ant_div_ctrl_antenna_get(void);
+
+/**
+ * @brief Handler of a received frame.
+ *
+ * Updates the RSSI estimate of the antenna that received the frame and the antenna preferred
+ * for the neighbor that sent it. The frame may be handled after the antenna was switched, so
+ * the antenna that received it is passed explicitly.
+ *
+ * @param[in]  p_psdu   Pointer to the buffer containing PHR and PSDU of the received frame.
+ * @param[in]  rssi     RSSI of the received frame [dBm].
+ * @param[in]  antenna  Antenna that received the frame.
+ */
+void nrf_802154_ant_div_ctrl_frame_received(const uint8_t              * p_psdu,
+                                            int8_t                       rssi,
+                                            nrf_802154_ant_div_antenna_t antenna);
+
+/**
+ * @brief Abort ongoing operations.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates termination request.
+ *
+ * @retval  true  Always.
+ */
+bool nrf_802154_ant_div_ctrl_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handler of the transmitted event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was transmitted.
+ */
+void nrf_802154_ant_div_ctrl_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handler of the TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true  Always.
+ */
+bool nrf_802154_ant_div_ctrl_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_ANT_DIV_CTRL_H__
@@ -43,19 +43,32 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_core_hooks.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_tx_desc.h"
+#include "nrf_802154_utils.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #if NRF_802154_CSMA_CA_ENABLED
 
-static uint8_t m_nb;  ///< The number of times the CSMA-CA algorithm was required to back off while attempting the current transmission.
-static uint8_t m_be;  ///< Backoff exponent, which is related to how many backoff periods a device shall wait before attempting to assess a channel.
+static uint8_t NRF_802154_PER_INSTANCE(m_nb); ///< The number of times the CSMA-CA algorithm was required to back off while attempting the current transmission.
+static uint8_t NRF_802154_PER_INSTANCE(m_be); ///< Backoff exponent, which is related to how many backoff periods a device shall wait before attempting to assess a channel.
+#define m_nb NRF_802154_INSTANCE_OF(m_nb)
+#define m_be NRF_802154_INSTANCE_OF(m_be)
 
-static const uint8_t    * mp_psdu;       ///< Pointer to PSDU of the frame being transmitted.
-static nrf_802154_timer_t m_timer;       ///< Timer used to back off during CSMA-CA procedure.
-static bool               m_is_running;  ///< Indicates if CSMA-CA procedure is running.
+static uint8_t NRF_802154_PER_INSTANCE(m_max_be);       ///< Maximal backoff exponent of the current transmission.
+static uint8_t NRF_802154_PER_INSTANCE(m_max_backoffs); ///< Maximal number of backoffs of the current transmission.
+#define m_max_be       NRF_802154_INSTANCE_OF(m_max_be)
+#define m_max_backoffs NRF_802154_INSTANCE_OF(m_max_backoffs)
+
+static const uint8_t    * NRF_802154_PER_INSTANCE(mp_psdu);      ///< Pointer to PSDU of the frame being transmitted.
+static nrf_802154_timer_t NRF_802154_PER_INSTANCE(m_timer);      ///< Timer used to back off during CSMA-CA procedure.
+static bool               NRF_802154_PER_INSTANCE(m_is_running); ///< Indicates if CSMA-CA procedure is running.
+#define mp_psdu      NRF_802154_INSTANCE_OF(mp_psdu)
+#define m_timer      NRF_802154_INSTANCE_OF(m_timer)
+#define m_is_running NRF_802154_INSTANCE_OF(m_is_running)
 
 /**
  * @brief Perform appropriate actions for busy channel conditions.
@@ -88,6 +101,25 @@ static void procedure_stop(void)
     m_is_running = false;
 }
 
+/**
+ * @brief Stop CSMA-CA procedure and notify MAC layer that transmission failed.
+ *
+ * The failure is passed to the transmit failed hooks like failures detected by the core, so that
+ * modules which hold resources of the frame release them.
+ *
+ * @param[in]  error  Reason of the failure.
+ */
+static void transmit_failed(nrf_802154_tx_error_t error)
+{
+    // Stopped procedure lets the CSMA-CA hook pass the failure instead of backing off again.
+    procedure_stop();
+
+    if (nrf_802154_core_hooks_tx_failed(mp_psdu, error))
+    {
+        nrf_802154_notify_transmit_failed(mp_psdu, error);
+    }
+}
+
 /**
  * Notify MAC layer that channel is busy if tx request failed and there are no retries left.
  *
@@ -95,9 +127,9 @@ static void procedure_stop(void)
  */
 static void notify_busy_channel(bool result)
 {
-    if (!result && (m_nb >= (NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS - 1)))
+    if (!result && (m_nb >= (m_max_backoffs - 1)))
     {
-        nrf_802154_notify_transmit_failed(mp_psdu, NRF_802154_TX_ERROR_BUSY_CHANNEL);
+        transmit_failed(NRF_802154_TX_ERROR_BUSY_CHANNEL);
     }
 }
 
@@ -134,8 +166,11 @@ static void frame_transmit(void * p_context)
 
 /**
  * @brief Delay CCA procedure for random (2^BE - 1) unit backoff periods.
+ *
+ * @retval true   The backoff is started.
+ * @retval false  The frame cannot be transmitted after the backoff before its deadline.
  */
-static void random_backoff_start(void)
+static bool random_backoff_start(void)
 {
     uint8_t backoff_periods = rand() % (1 << m_be);
 
@@ -144,7 +179,24 @@ static void random_backoff_start(void)
     m_timer.t0        = nrf_802154_timer_sched_time_get();
     m_timer.dt        = backoff_periods * UNIT_BACKOFF_PERIOD;
 
+#if NRF_802154_TX_EX_ENABLED
+    if (!nrf_802154_tx_desc_deadline_is_met(mp_psdu, m_timer.t0 + m_timer.dt, true))
+    {
+        return false;
+    }
+#endif // NRF_802154_TX_EX_ENABLED
+
     nrf_802154_timer_sched_add(&m_timer, false);
+
+    return true;
+}
+
+/**
+ * @brief Stop CSMA-CA procedure of a frame that cannot be transmitted before its deadline.
+ */
+static void deadline_missed(void)
+{
+    transmit_failed(NRF_802154_TX_ERROR_DEADLINE);
 }
 
 static bool channel_busy(void)
@@ -157,14 +209,18 @@ static bool channel_busy(void)
 
         m_nb++;
 
-        if (m_be < NRF_802154_CSMA_CA_MAX_BE)
+        if (m_be < m_max_be)
         {
             m_be++;
         }
 
-        if (m_nb < NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS)
+        if (m_nb < m_max_backoffs)
         {
-            random_backoff_start();
+            if (!random_backoff_start())
+            {
+                deadline_missed();
+            }
+
             result = false;
         }
         else
@@ -182,12 +238,28 @@ void nrf_802154_csma_ca_start(const uint8_t * p_data)
 {
     assert(!procedure_is_running());
 
-    mp_psdu      = p_data;
-    m_nb         = 0;
-    m_be         = NRF_802154_CSMA_CA_MIN_BE;
-    m_is_running = true;
+    mp_psdu        = p_data;
+    m_nb           = 0;
+    m_be           = NRF_802154_CSMA_CA_MIN_BE;
+    m_max_be       = NRF_802154_CSMA_CA_MAX_BE;
+    m_max_backoffs = NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS;
+    m_is_running   = true;
+
+#if NRF_802154_TX_EX_ENABLED
+    const nrf_802154_tx_desc_t * p_desc = nrf_802154_tx_desc_get(p_data);
 
-    random_backoff_start();
+    if ((p_desc != NULL) && (p_desc->flags & NRF_802154_TX_DESC_CSMA_CA))
+    {
+        m_be           = p_desc->min_be;
+        m_max_be       = p_desc->max_be;
+        m_max_backoffs = p_desc->max_backoffs;
+    }
+#endif // NRF_802154_TX_EX_ENABLED
+
+    if (!random_backoff_start())
+    {
+        deadline_missed();
+    }
 }
 
 bool nrf_802154_csma_ca_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
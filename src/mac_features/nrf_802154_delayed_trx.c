@@ -42,17 +42,28 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_core.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
 #include "nrf_802154_rsch.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_DELAYED_TRX_ENABLED
 
 #define TX_SETUP_TIME 190  ///< Time [us] needed to change channel, stop rx and setup tx procedure.
 
-static const uint8_t * mp_tx_psdu;    ///< Pointer to PHR + PSDU of the frame requested to transmit.
-static bool            m_tx_cca;      ///< If CCA should be performed prior to transmission.
-static uint8_t         m_tx_channel;  ///< Channel number on which transmission should be performed.
+static const uint8_t * NRF_802154_PER_INSTANCE(mp_tx_psdu);   ///< Pointer to PHR + PSDU of the frame requested to transmit.
+static bool            NRF_802154_PER_INSTANCE(m_tx_cca);     ///< If CCA should be performed prior to transmission.
+static uint8_t         NRF_802154_PER_INSTANCE(m_tx_channel); ///< Channel number on which transmission should be performed.
+#define mp_tx_psdu   NRF_802154_INSTANCE_OF(mp_tx_psdu)
+#define m_tx_cca     NRF_802154_INSTANCE_OF(m_tx_cca)
+#define m_tx_channel NRF_802154_INSTANCE_OF(m_tx_channel)
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+static uint32_t        NRF_802154_PER_INSTANCE(m_tx_trigger_time); ///< Time at which ramp up of the transmission should start.
+#define m_tx_trigger_time NRF_802154_INSTANCE_OF(m_tx_trigger_time)
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
 
 /**
  * Check if delayed transmission procedure is in progress.
@@ -65,6 +76,34 @@ static bool tx_is_in_progress(void)
     return mp_tx_psdu != NULL;
 }
 
+/**
+ * Claim delayed transmission procedure for a frame.
+ *
+ * Delayed transmission is requested by the higher layer and by the Green Power response feature
+ * from the RADIO IRQ handler or the bottom half. The check and the claim must be atomic, so that
+ * a request preempting another one does not overwrite its frame.
+ *
+ * @param[in]  p_data  Pointer to PHR + PSDU of the frame requested to transmit.
+ *
+ * @retval true   Delayed transmission procedure is claimed for the frame.
+ * @retval false  Delayed transmission procedure is already in progress.
+ */
+static bool tx_claim(const uint8_t * p_data)
+{
+    do
+    {
+        if (__LDREXW((volatile uint32_t *)&mp_tx_psdu) != 0)
+        {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXW((uint32_t)p_data, (volatile uint32_t *)&mp_tx_psdu));
+
+    __DMB();
+
+    return true;
+}
+
 /**
  * Mark that delayed transmission procedure has stopped.
  */
@@ -92,12 +131,13 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
                                      uint32_t        dt,
                                      uint8_t         channel)
 {
-    bool     result = true;
+    bool     result = tx_claim(p_data);
     uint16_t timeslot_length;
 
-    if (tx_is_in_progress())
+    if (!result)
     {
-        result = false;
+        // Another frame is in progress. This frame is reported like a frame with denied timeslot.
+        nrf_802154_notify_transmit_failed(p_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
     }
 
     if (result)
@@ -110,9 +150,11 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
             dt -= nrf_802154_cca_before_tx_duration_get();
         }
 
-        mp_tx_psdu   = p_data;
         m_tx_cca     = cca;
         m_tx_channel = channel;
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+        m_tx_trigger_time = t0 + dt + TX_SETUP_TIME;
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
 
         timeslot_length = nrf_802154_tx_duration_get(p_data[0],
                                                      cca,
@@ -141,6 +183,11 @@ void nrf_802154_rsch_delayed_timeslot_started(void)
 
     if (result)
     {
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+        // Software only prepares the transmission, ramp up is started by the HP timer.
+        nrf_802154_core_tx_trigger_set(m_tx_trigger_time);
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+
         result = nrf_802154_request_transmit(NRF_802154_TERM_802154,
                                              REQ_ORIG_DELAYED_TRX,
                                              mp_tx_psdu,
@@ -148,6 +195,10 @@ void nrf_802154_rsch_delayed_timeslot_started(void)
                                              true,
                                              notify_tx_timeslot_denied);
         (void)result;
+
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+        nrf_802154_core_tx_trigger_clear();
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
     }
     else
     {
@@ -165,3 +216,5 @@ void nrf_802154_rsch_delayed_timeslot_failed(void)
 
     tx_stop();
 }
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED
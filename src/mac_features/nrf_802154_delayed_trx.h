@@ -54,6 +54,10 @@
  * @ref nrf_802154_tx_started is called. If the requested frame cannot be transmitted at given time
  * the @ref nrf_802154_transmit_failed function is called.
  *
+ * This function may be called from the RADIO IRQ handler and preempt a call from another context.
+ * Only one delayed transmission can be in progress. A frame requested while another one is in
+ * progress is rejected and reported with @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED.
+ *
  * @note Delayed transmission does not timeout waiting for ACK automatically. Waiting for ACK shall
  *       be timed out by the next higher layer or the ACK timeout module. The ACK timeout timer
  *       shall start when the @ref nrf_802154_tx_started function is called.
@@ -63,6 +67,9 @@
  * @param[in]  t0       Base of delay time.
  * @param[in]  dt       Delta of delay time from @p t0.
  * @param[in]  channel  Number of channel on which the frame should be transmitted.
+ *
+ * @retval  true   The transmission is scheduled.
+ * @retval  false  The transmission could not be scheduled. The failure is already notified.
  */
 bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
                                      bool            cca,
@@ -46,6 +46,7 @@
 
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_utils.h"
 
 #define FCF_CHECK_OFFSET           (PHR_SIZE + FCF_SIZE)
 #define SHORT_ADDR_CHECK_OFFSET    (DEST_ADDR_OFFSET + SHORT_ADDRESS_SIZE)
@@ -60,6 +61,7 @@
  * @retval true   Given frame version is allowed for given frame type.
  * @retval false  Given frame version is not allowed for given frame type.
  */
+NRF_802154_RAM_CODE
 static bool frame_type_and_version_filter(uint8_t frame_type, uint8_t frame_version)
 {
     bool result;
@@ -99,6 +101,7 @@ static bool frame_type_and_version_filter(uint8_t frame_type, uint8_t frame_vers
  * @retval true   Given frame type may include addressing fields.
  * @retval false  Given frame type may not include addressing fields.
  */
+NRF_802154_RAM_CODE
 static bool dst_addressing_may_be_present(uint8_t frame_type)
 {
     bool result;
@@ -143,6 +146,7 @@ static bool dst_addressing_may_be_present(uint8_t frame_type)
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Detected an error in given frame - it should be
  *                                                discarded.
  */
+NRF_802154_RAM_CODE
 static nrf_802154_rx_error_t dst_addressing_end_offset_get_2006(const uint8_t * p_psdu,
                                                                 uint8_t       * p_num_bytes,
                                                                 uint8_t         frame_type)
@@ -212,6 +216,7 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2006(const uint8_t *
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Detected an error in given frame - it should be
  *                                                discarded.
  */
+NRF_802154_RAM_CODE
 static nrf_802154_rx_error_t dst_addressing_end_offset_get_2015(const uint8_t * p_psdu,
                                                                 uint8_t       * p_num_bytes,
                                                                 uint8_t         frame_type)
@@ -264,6 +269,7 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get_2015(const uint8_t *
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Detected an error in given frame - it should be
  *                                                discarded.
  */
+NRF_802154_RAM_CODE
 static nrf_802154_rx_error_t dst_addressing_end_offset_get(const uint8_t * p_psdu,
                                                            uint8_t       * p_num_bytes,
                                                            uint8_t         frame_type,
@@ -297,6 +303,7 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get(const uint8_t * p_psd
  * @retval true   PAN Id of incoming frame allows further processing of the frame.
  * @retval false  PAN Id of incoming frame does not allow further processing.
  */
+NRF_802154_RAM_CODE
 static bool dst_pan_id_check(const uint8_t * p_psdu)
 {
     bool result;
@@ -327,6 +334,7 @@ static bool dst_pan_id_check(const uint8_t * p_psdu)
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
+NRF_802154_RAM_CODE
 static bool dst_short_addr_check(const uint8_t * p_psdu)
 {
     bool result;
@@ -363,6 +371,7 @@ static bool dst_short_addr_check(const uint8_t * p_psdu)
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
+NRF_802154_RAM_CODE
 static bool dst_extended_addr_check(const uint8_t *p_psdu)
 {
     bool result;
@@ -390,6 +399,7 @@ static bool dst_extended_addr_check(const uint8_t *p_psdu)
     return result;
 }
 
+NRF_802154_RAM_CODE
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_psdu, uint8_t * p_num_bytes)
 {
     nrf_802154_rx_error_t result = NRF_802154_RX_ERROR_INVALID_FRAME;
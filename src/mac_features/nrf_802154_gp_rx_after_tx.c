@@ -0,0 +1,253 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements transmission of responses to Green Power Devices for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_gp_rx_after_tx.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_delayed_trx.h"
+
+#if NRF_802154_GP_RX_AFTER_TX_ENABLED
+
+#if !NRF_802154_DELAYED_TRX_ENABLED || !NRF_802154_FRAME_TIMESTAMP_ENABLED
+#error NRF_802154_GP_RX_AFTER_TX_ENABLED requires delayed transmission and frame timestamps
+#endif
+
+#define SECURITY_ENABLED_OFFSET 1    ///< Byte containing MAC security enabled bit (+1 for frame length byte)
+#define SECURITY_ENABLED_BIT    0x08 ///< MAC security enabled bit
+
+#define GP_NWK_FRAME_TYPE_MASK  0x03 ///< Mask of bits containing GPDF frame type
+#define GP_NWK_FRAME_TYPE_DATA  0x00 ///< Bits containing data GPDF frame type
+#define GP_NWK_PROTOCOL_MASK    0x3c ///< Mask of bits containing protocol version
+#define GP_NWK_PROTOCOL_GP      0x0c ///< Bits containing Green Power protocol version
+#define GP_NWK_EXT_BIT          0x80 ///< Bit indicating presence of extended NWK frame control
+#define GP_EXT_APP_ID_MASK      0x07 ///< Mask of bits containing Application ID
+#define GP_EXT_APP_ID_SRC_ID    0x00 ///< Bits containing Application ID of GPD identified by source ID
+#define GP_EXT_RX_AFTER_TX_BIT  0x40 ///< Bit indicating that the GPD receives after transmission
+#define GP_EXT_DIRECTION_BIT    0x80 ///< Bit indicating that the GPDF is sent to the GPD
+#define GP_SRC_ID_SIZE          4    ///< Size of GPD source ID
+
+typedef struct
+{
+    uint32_t        src_id; ///< Source ID of the GPD.
+    const uint8_t * p_data; ///< Pointer to PHR and PSDU of the response.
+    volatile bool   in_use; ///< If this entry describes a response.
+} response_t;
+
+static response_t NRF_802154_PER_INSTANCE(m_responses)[NRF_802154_GP_RX_AFTER_TX_RESPONSES]; ///< Responses waiting for GPDFs.
+#define m_responses NRF_802154_INSTANCE_OF(m_responses)
+
+/**
+ * @brief Get offset of the NWK header of a GPDF.
+ *
+ * @param[in]  p_psdu  Pointer to the buffer containing PHR and PSDU of the frame.
+ *
+ * @return  Offset of the NWK header or 0 if the frame cannot be a GPDF.
+ */
+static uint8_t nwk_header_offset_get(const uint8_t * p_psdu)
+{
+    uint8_t offset = SRC_ADDR_OFFSET_SHORT_DST;
+
+    if (((p_psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_DATA) ||
+        ((p_psdu[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2) ||
+        (p_psdu[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT) ||
+        ((p_psdu[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK) != DEST_ADDR_TYPE_SHORT))
+    {
+        return 0;
+    }
+
+    if ((p_psdu[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK) != SRC_ADDR_TYPE_NONE)
+    {
+        if (0 == (p_psdu[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK))
+        {
+            offset += PAN_ID_SIZE;
+        }
+
+        offset += ((p_psdu[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK) == SRC_ADDR_TYPE_EXTENDED) ?
+                  EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    }
+
+    return offset;
+}
+
+/**
+ * @brief Get source ID of a GPD that receives after transmission of a frame.
+ *
+ * @param[in]   p_psdu    Pointer to the buffer containing PHR and PSDU of the frame.
+ * @param[out]  p_src_id  Source ID of the GPD.
+ *
+ * @retval  true   The frame is a GPDF requesting reception after transmission.
+ * @retval  false  The frame is not such a GPDF.
+ */
+static bool rx_after_tx_src_id_get(const uint8_t * p_psdu, uint32_t * p_src_id)
+{
+    uint8_t offset = nwk_header_offset_get(p_psdu);
+    uint8_t nwk_fc;
+    uint8_t ext_fc;
+
+    // Frame control, extended frame control and source ID must fit before FCS.
+    if ((offset == 0) || (offset + 1 + GP_SRC_ID_SIZE > p_psdu[0] - FCS_SIZE))
+    {
+        return false;
+    }
+
+    nwk_fc = p_psdu[offset];
+    ext_fc = p_psdu[offset + 1];
+
+    if (((nwk_fc & GP_NWK_FRAME_TYPE_MASK) != GP_NWK_FRAME_TYPE_DATA) ||
+        ((nwk_fc & GP_NWK_PROTOCOL_MASK) != GP_NWK_PROTOCOL_GP) ||
+        ((nwk_fc & GP_NWK_EXT_BIT) == 0) ||
+        ((ext_fc & GP_EXT_APP_ID_MASK) != GP_EXT_APP_ID_SRC_ID) ||
+        ((ext_fc & GP_EXT_RX_AFTER_TX_BIT) == 0) ||
+        (ext_fc & GP_EXT_DIRECTION_BIT))
+    {
+        return false;
+    }
+
+    *p_src_id = (uint32_t)p_psdu[offset + 2] |
+                ((uint32_t)p_psdu[offset + 3] << 8) |
+                ((uint32_t)p_psdu[offset + 4] << 16) |
+                ((uint32_t)p_psdu[offset + 5] << 24);
+
+    return true;
+}
+
+/**
+ * @brief Find a response.
+ *
+ * @param[in]  src_id  Source ID of the GPD.
+ *
+ * @return  Pointer to the response or NULL if no response is registered for the GPD.
+ */
+static response_t * response_find(uint32_t src_id)
+{
+    for (uint8_t i = 0; i < NRF_802154_GP_RX_AFTER_TX_RESPONSES; i++)
+    {
+        response_t * p_response = &m_responses[i];
+
+        if (p_response->in_use && (p_response->src_id == src_id))
+        {
+            return p_response;
+        }
+    }
+
+    return NULL;
+}
+
+bool nrf_802154_gp_rx_after_tx_response_add(uint32_t src_id, const uint8_t * p_data)
+{
+    response_t * p_response = response_find(src_id);
+
+    if (p_response != NULL)
+    {
+        // Unregister the previous response before the buffer is replaced.
+        p_response->in_use = false;
+    }
+    else
+    {
+        for (uint8_t i = 0; i < NRF_802154_GP_RX_AFTER_TX_RESPONSES; i++)
+        {
+            if (!m_responses[i].in_use)
+            {
+                p_response = &m_responses[i];
+                break;
+            }
+        }
+    }
+
+    if (p_response == NULL)
+    {
+        return false;
+    }
+
+    p_response->src_id = src_id;
+    p_response->p_data = p_data;
+    p_response->in_use = true;
+
+    return true;
+}
+
+bool nrf_802154_gp_rx_after_tx_response_remove(uint32_t src_id)
+{
+    response_t * p_response = response_find(src_id);
+
+    if (p_response == NULL)
+    {
+        return false;
+    }
+
+    p_response->in_use = false;
+
+    return true;
+}
+
+void nrf_802154_gp_rx_after_tx_frame_received(const uint8_t * p_psdu, uint32_t timestamp)
+{
+    response_t    * p_response;
+    const uint8_t * p_data;
+    uint32_t        src_id;
+
+    if (!rx_after_tx_src_id_get(p_psdu, &src_id))
+    {
+        return;
+    }
+
+    p_response = response_find(src_id);
+
+    if (p_response == NULL)
+    {
+        return;
+    }
+
+    // The response is sent once. If it cannot be scheduled, e.g. because the higher layer requested
+    // another delayed transmission, the failure is notified and the higher layer may register
+    // the response again for the next GPDF.
+    p_data             = p_response->p_data;
+    p_response->in_use = false;
+
+    (void)nrf_802154_delayed_trx_transmit(p_data,
+                                          false,
+                                          timestamp,
+                                          NRF_802154_GP_RX_AFTER_TX_OFFSET,
+                                          nrf_802154_pib_channel_get());
+}
+
+#endif // NRF_802154_GP_RX_AFTER_TX_ENABLED
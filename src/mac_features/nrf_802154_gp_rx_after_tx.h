@@ -0,0 +1,90 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_GP_RX_AFTER_TX_H__
+#define NRF_802154_GP_RX_AFTER_TX_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @defgroup nrf_802154_gp_rx_after_tx 802.15.4 driver Green Power response transmission
+ * @{
+ * @ingroup nrf_802154
+ * @brief Transmission of responses in the receive window opened by Green Power Devices.
+ *
+ * A Green Power Device (GPD) that sets the RxAfterTx bit in its Green Power Device Frame (GPDF)
+ * enables its receiver for a short time at a fixed offset after the transmission. When such
+ * a GPDF comes from a GPD with a registered response, the driver schedules the response with
+ * the delayed transmission feature at @ref NRF_802154_GP_RX_AFTER_TX_OFFSET from the timestamp
+ * of the GPDF, on the channel the GPDF was received on.
+ */
+
+/**
+ * @brief Register a response to be transmitted after the next GPDF from a GPD.
+ *
+ * The response replaces the response previously registered for the same GPD.
+ *
+ * @param[in]  src_id  Source ID of the GPD.
+ * @param[in]  p_data  Pointer to the buffer containing PHR and PSDU of the response.
+ *
+ * @retval  true   The response is registered.
+ * @retval  false  There is no space left for another response
+ *                 (see @ref NRF_802154_GP_RX_AFTER_TX_RESPONSES).
+ */
+bool nrf_802154_gp_rx_after_tx_response_add(uint32_t src_id, const uint8_t * p_data);
+
+/**
+ * @brief Remove the response registered for a GPD.
+ *
+ * @param[in]  src_id  Source ID of the GPD.
+ *
+ * @retval  true   The response is removed.
+ * @retval  false  There was no response registered for the GPD.
+ */
+bool nrf_802154_gp_rx_after_tx_response_remove(uint32_t src_id);
+
+/**
+ * @brief Handler of a received frame.
+ *
+ * If the frame is a GPDF requesting reception after transmission from a GPD with a registered
+ * response, the response is scheduled and unregistered. If the response cannot be scheduled,
+ * the failure is notified with @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED.
+ *
+ * @param[in]  p_psdu     Pointer to the buffer containing PHR and PSDU of the received frame.
+ * @param[in]  timestamp  Timestamp of the received frame [us].
+ */
+void nrf_802154_gp_rx_after_tx_frame_received(const uint8_t * p_psdu, uint32_t timestamp);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_GP_RX_AFTER_TX_H__
@@ -0,0 +1,190 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements neighbor tracking shared by the 802.15.4 driver features.
+ *
+ */
+
+#include "nrf_802154_neighbor.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+
+const uint8_t * nrf_802154_neighbor_dst_addr_get(const uint8_t * p_frame, bool * p_extended)
+{
+    const uint8_t * p_dst_addr = &p_frame[DEST_ADDR_OFFSET];
+
+    switch (p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK)
+    {
+        case DEST_ADDR_TYPE_SHORT:
+            *p_extended = false;
+            break;
+
+        case DEST_ADDR_TYPE_EXTENDED:
+            *p_extended = true;
+            break;
+
+        default:
+            return NULL;
+    }
+
+    // 2015 frames elide destination PAN Id if it is compressed and there is no source address.
+    if (((p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2) &&
+        (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) &&
+        ((p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK) == SRC_ADDR_TYPE_NONE))
+    {
+        p_dst_addr -= PAN_ID_SIZE;
+    }
+
+    return p_dst_addr;
+}
+
+const uint8_t * nrf_802154_neighbor_src_addr_get(const uint8_t * p_frame, bool * p_extended)
+{
+    const uint8_t * p_src_addr;
+
+    switch (p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK)
+    {
+        case DEST_ADDR_TYPE_SHORT:
+            p_src_addr = &p_frame[SRC_ADDR_OFFSET_SHORT_DST];
+            break;
+
+        case DEST_ADDR_TYPE_EXTENDED:
+            p_src_addr = &p_frame[SRC_ADDR_OFFSET_EXTENDED_DST];
+            break;
+
+        default:
+            return NULL;
+    }
+
+    if (0 == (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK))
+    {
+        p_src_addr += PAN_ID_SIZE;
+    }
+
+    switch (p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK)
+    {
+        case SRC_ADDR_TYPE_SHORT:
+            *p_extended = false;
+            break;
+
+        case SRC_ADDR_TYPE_EXTENDED:
+            *p_extended = true;
+            break;
+
+        default:
+            return NULL;
+    }
+
+    return p_src_addr;
+}
+
+void * nrf_802154_neighbor_find(void          * p_table,
+                                size_t          entry_size,
+                                uint8_t         count,
+                                const uint8_t * p_addr,
+                                bool            extended)
+{
+    uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        nrf_802154_neighbor_id_t * p_id =
+            (nrf_802154_neighbor_id_t *)((uint8_t *)p_table + i * entry_size);
+
+        if (p_id->in_use &&
+            (p_id->extended == extended) &&
+            (0 == memcmp(p_id->addr, p_addr, addr_size)))
+        {
+            return p_id;
+        }
+    }
+
+    return NULL;
+}
+
+void nrf_802154_neighbor_id_set(nrf_802154_neighbor_id_t * p_id,
+                                const uint8_t            * p_addr,
+                                bool                       extended)
+{
+    uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    memset(p_id->addr, 0, sizeof(p_id->addr));
+    memcpy(p_id->addr, p_addr, addr_size);
+    p_id->extended = extended;
+    p_id->in_use   = true;
+}
+
+void nrf_802154_neighbor_pending_set(nrf_802154_neighbor_pending_t * p_pending,
+                                     const uint8_t                 * p_frame)
+{
+    const uint8_t * p_dst_addr;
+    bool            extended;
+
+    p_dst_addr = nrf_802154_neighbor_dst_addr_get(p_frame, &extended);
+
+    if (p_dst_addr != NULL)
+    {
+        nrf_802154_neighbor_id_set(&p_pending->dst, p_dst_addr, extended);
+    }
+    else
+    {
+        p_pending->dst.in_use = false;
+    }
+
+    p_pending->p_frame = p_frame;
+}
+
+void nrf_802154_neighbor_pending_clear(nrf_802154_neighbor_pending_t * p_pending)
+{
+    p_pending->p_frame    = NULL;
+    p_pending->dst.in_use = false;
+}
+
+bool nrf_802154_neighbor_pending_take(nrf_802154_neighbor_pending_t * p_pending,
+                                      nrf_802154_neighbor_id_t      * p_dst)
+{
+    bool result = (p_pending->p_frame != NULL) && p_pending->dst.in_use;
+
+    if (result)
+    {
+        *p_dst = p_pending->dst;
+    }
+
+    nrf_802154_neighbor_pending_clear(p_pending);
+
+    return result;
+}
@@ -0,0 +1,154 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_NEIGHBOR_H__
+#define NRF_802154_NEIGHBOR_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+
+/**
+ * @defgroup nrf_802154_neighbor 802.15.4 driver neighbor tracking
+ * @{
+ * @ingroup nrf_802154
+ * @brief Addresses of neighbors and the neighbor a frame waiting for ACK is sent to.
+ *
+ * Neighbor tables are arrays of module specific entries. Each entry starts with
+ * @ref nrf_802154_neighbor_id_t, so that the table can be searched by this module.
+ */
+
+/**
+ * @brief Identity of a neighbor.
+ */
+typedef struct
+{
+    uint8_t       addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the neighbor (little-endian).
+    bool          extended;                    ///< If @ref addr is an extended address.
+    volatile bool in_use;                      ///< If this entry describes a neighbor.
+} nrf_802154_neighbor_id_t;
+
+/**
+ * @brief Frame waiting for ACK.
+ */
+typedef struct
+{
+    const uint8_t          * p_frame; ///< Pointer to the frame or NULL if no frame is waiting for ACK.
+    nrf_802154_neighbor_id_t dst;     ///< Destination of the frame. Not in use if the frame has no destination address.
+} nrf_802154_neighbor_pending_t;
+
+/**
+ * @brief Get destination address of a frame.
+ *
+ * @param[in]   p_frame     Pointer to the buffer containing PHR and PSDU of the frame.
+ * @param[out]  p_extended  If the destination address is extended.
+ *
+ * @return  Pointer to the destination address or NULL if the frame has no destination address.
+ */
+const uint8_t * nrf_802154_neighbor_dst_addr_get(const uint8_t * p_frame, bool * p_extended);
+
+/**
+ * @brief Get source address of a frame.
+ *
+ * @param[in]   p_frame     Pointer to the buffer containing PHR and PSDU of the frame.
+ * @param[out]  p_extended  If the source address is extended.
+ *
+ * @return  Pointer to the source address or NULL if the frame has no destination or source address.
+ */
+const uint8_t * nrf_802154_neighbor_src_addr_get(const uint8_t * p_frame, bool * p_extended);
+
+/**
+ * @brief Find a neighbor in a neighbor table.
+ *
+ * @param[in]  p_table     Pointer to the first entry of the table.
+ * @param[in]  entry_size  Size of an entry of the table.
+ * @param[in]  count       Number of entries in the table.
+ * @param[in]  p_addr      Pointer to the address of the neighbor.
+ * @param[in]  extended    If the given address is extended.
+ *
+ * @return  Pointer to the entry of the neighbor or NULL if the neighbor is not in the table.
+ */
+void * nrf_802154_neighbor_find(void          * p_table,
+                                size_t          entry_size,
+                                uint8_t         count,
+                                const uint8_t * p_addr,
+                                bool            extended);
+
+/**
+ * @brief Set identity of a neighbor.
+ *
+ * The entry is marked as used.
+ *
+ * @param[out]  p_id      Pointer to the identity to set.
+ * @param[in]   p_addr    Pointer to the address of the neighbor.
+ * @param[in]   extended  If the given address is extended.
+ */
+void nrf_802154_neighbor_id_set(nrf_802154_neighbor_id_t * p_id,
+                                const uint8_t            * p_addr,
+                                bool                       extended);
+
+/**
+ * @brief Store a frame that waits for ACK.
+ *
+ * The destination address is copied, so that it is known after the frame buffer is released.
+ * A frame stored previously is replaced.
+ *
+ * @param[out]  p_pending  Pointer to the pending frame descriptor.
+ * @param[in]   p_frame    Pointer to the buffer containing PHR and PSDU of the frame.
+ */
+void nrf_802154_neighbor_pending_set(nrf_802154_neighbor_pending_t * p_pending,
+                                     const uint8_t                 * p_frame);
+
+/**
+ * @brief Clear the frame waiting for ACK without a result of its transmission.
+ *
+ * @param[out]  p_pending  Pointer to the pending frame descriptor.
+ */
+void nrf_802154_neighbor_pending_clear(nrf_802154_neighbor_pending_t * p_pending);
+
+/**
+ * @brief Get destination of the frame waiting for ACK and clear the pending frame.
+ *
+ * @param[inout]  p_pending  Pointer to the pending frame descriptor.
+ * @param[out]    p_dst      Pointer to the destination of the frame.
+ *
+ * @retval  true   A frame was waiting for ACK and @p p_dst describes its destination.
+ * @retval  false  There was no frame waiting for ACK or the frame had no destination address.
+ */
+bool nrf_802154_neighbor_pending_take(nrf_802154_neighbor_pending_t * p_pending,
+                                      nrf_802154_neighbor_id_t      * p_dst);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_NEIGHBOR_H__
@@ -0,0 +1,153 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements receive window after transmission for the 802.15.4 driver.
+ *
+ * If receiver is disabled when idle, the driver stays in receive state for a configured time after
+ * the transmission procedure ends and then falls asleep.
+ *
+ */
+
+#include "nrf_802154_rx_window.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_utils.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
+#define RETRY_DELAY     500      ///< Procedure is delayed by this time if cannot be performed at the moment.
+#define MAX_RETRY_DELAY 1000000  ///< Maximal allowed delay of procedure retry.
+
+static nrf_802154_timer_t NRF_802154_PER_INSTANCE(m_timer);               ///< Timer used to end the receive window.
+static volatile bool      NRF_802154_PER_INSTANCE(m_procedure_is_active); ///< Indicates if receive window is open.
+#define m_timer               NRF_802154_INSTANCE_OF(m_timer)
+#define m_procedure_is_active NRF_802154_INSTANCE_OF(m_procedure_is_active)
+
+static void window_timer_retry(void);
+
+static void window_timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    if (m_procedure_is_active)
+    {
+        // Mark procedure as stopped before the request to ignore abort hook called by this request.
+        m_procedure_is_active = false;
+
+        if (!nrf_802154_request_sleep(NRF_802154_TERM_NONE))
+        {
+            // Frame is being received. Try again later.
+            m_procedure_is_active = true;
+            window_timer_retry();
+        }
+    }
+}
+
+static void window_timer_retry(void)
+{
+    m_timer.dt += RETRY_DELAY;
+    assert(m_timer.dt <= MAX_RETRY_DELAY);
+
+    nrf_802154_timer_sched_add(&m_timer, true);
+}
+
+static void window_timer_start(void)
+{
+    uint32_t window = nrf_802154_pib_rx_window_after_tx_get();
+
+    if (nrf_802154_pib_rx_on_when_idle_get() || (window == 0))
+    {
+        // Receiver is left enabled or the core already falls asleep.
+        return;
+    }
+
+    m_timer.callback  = window_timer_fired;
+    m_timer.p_context = NULL;
+    m_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_timer.dt        = window;
+
+    m_procedure_is_active = true;
+
+    nrf_802154_timer_sched_add(&m_timer, true);
+}
+
+static void window_timer_stop(void)
+{
+    m_procedure_is_active = false;
+
+    // To make sure `window_timer_fired()` detects that procedure is being stopped if it preempts
+    // this function.
+    __DMB();
+
+    nrf_802154_timer_sched_remove(&m_timer);
+}
+
+bool nrf_802154_rx_window_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    (void)term_lvl;
+
+    if (m_procedure_is_active && (req_orig != REQ_ORIG_RSCH))
+    {
+        window_timer_stop();
+    }
+
+    return true;
+}
+
+void nrf_802154_rx_window_transmitted_hook(const uint8_t * p_frame)
+{
+    (void)p_frame;
+
+    window_timer_start();
+}
+
+bool nrf_802154_rx_window_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+
+    // Aborted transmission is followed by the operation requested by the aborting module.
+    if (error != NRF_802154_TX_ERROR_ABORTED)
+    {
+        window_timer_start();
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
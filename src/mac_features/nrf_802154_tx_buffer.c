@@ -0,0 +1,159 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the pool of transmit buffers used by the 802.15.4 driver API that copies
+ *   frames.
+ *
+ */
+
+#include "nrf_802154_tx_buffer.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#if !NRF_802154_USE_RAW_API
+
+#define PSDU_OFFSET PHR_SIZE ///< Offset of PSDU in the transmit buffer.
+
+#if NRF_802154_TX_BUFFERS < 1
+#error NRF_802154_TX_BUFFERS shall be greater than 0
+#endif
+
+/// Transmit buffers containing PHR and PSDU of copied frames.
+static uint8_t NRF_802154_PER_INSTANCE(m_tx_buffers)[NRF_802154_TX_BUFFERS][PHR_SIZE + MAX_PACKET_SIZE];
+#define m_tx_buffers NRF_802154_INSTANCE_OF(m_tx_buffers)
+
+static volatile bool NRF_802154_PER_INSTANCE(m_in_use)[NRF_802154_TX_BUFFERS]; ///< If given transmit buffer is used by a transmission.
+static uint8_t       NRF_802154_PER_INSTANCE(m_next);                          ///< Index of the buffer checked first by the next allocation.
+#define m_in_use NRF_802154_INSTANCE_OF(m_in_use)
+#define m_next   NRF_802154_INSTANCE_OF(m_next)
+
+/**
+ * @brief Get index of given transmit buffer.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU of a frame.
+ *
+ * @return  Index of the buffer or NRF_802154_TX_BUFFERS if @p p_frame is not a transmit buffer.
+ */
+static uint32_t buffer_index_get(const uint8_t * p_frame)
+{
+    for (uint32_t i = 0; i < NRF_802154_TX_BUFFERS; i++)
+    {
+        if (p_frame == m_tx_buffers[i])
+        {
+            return i;
+        }
+    }
+
+    return NRF_802154_TX_BUFFERS;
+}
+
+/**
+ * @brief Release given transmit buffer if it belongs to the pool.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU of a frame.
+ */
+static void buffer_release(const uint8_t * p_frame)
+{
+    uint32_t index = buffer_index_get(p_frame);
+
+    if (index < NRF_802154_TX_BUFFERS)
+    {
+        m_in_use[index] = false;
+    }
+}
+
+const uint8_t * nrf_802154_tx_buffer_alloc(const uint8_t * p_data, uint8_t length)
+{
+    assert(length <= MAX_PACKET_SIZE - FCS_SIZE);
+
+    for (uint32_t i = 0; i < NRF_802154_TX_BUFFERS; i++)
+    {
+        uint32_t index = (m_next + i) % NRF_802154_TX_BUFFERS;
+
+        if (!m_in_use[index])
+        {
+            m_in_use[index] = true;
+            m_next          = (index + 1) % NRF_802154_TX_BUFFERS;
+
+            m_tx_buffers[index][0] = length + FCS_SIZE;
+            memcpy(&m_tx_buffers[index][PSDU_OFFSET], p_data, length);
+
+            return m_tx_buffers[index];
+        }
+    }
+
+    return NULL;
+}
+
+void nrf_802154_tx_buffer_free(const uint8_t * p_frame)
+{
+    buffer_release(p_frame);
+}
+
+bool nrf_802154_tx_buffer_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    // Any transmission is terminated by a request with this termination level.
+    if (term_lvl >= NRF_802154_TERM_802154)
+    {
+        for (uint32_t i = 0; i < NRF_802154_TX_BUFFERS; i++)
+        {
+            m_in_use[i] = false;
+        }
+    }
+
+    return true;
+}
+
+void nrf_802154_tx_buffer_transmitted_hook(const uint8_t * p_frame)
+{
+    buffer_release(p_frame);
+}
+
+bool nrf_802154_tx_buffer_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)error;
+
+    buffer_release(p_frame);
+
+    return true;
+}
+
+#endif // !NRF_802154_USE_RAW_API
@@ -0,0 +1,99 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_TX_BUFFER_H__
+#define NRF_802154_TX_BUFFER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tx_buffer 802.15.4 driver transmit buffers
+ * @{
+ * @ingroup nrf_802154
+ * @brief Pool of transmit buffers used by the API that copies frames.
+ *
+ * A buffer is allocated when a frame is copied and released when the transmission ends. Buffers
+ * are allocated round-robin, so the next frame can be copied while the previous one is still
+ * transmitted or reported to the MAC layer.
+ */
+
+/**
+ * @brief Allocate a transmit buffer and copy given frame to it.
+ *
+ * @param[in]  p_data  Pointer to PSDU of the frame without FCS.
+ * @param[in]  length  Length of PSDU without FCS.
+ *
+ * @return  Pointer to the transmit buffer (PHR and PSDU) or NULL if all buffers are in use.
+ */
+const uint8_t * nrf_802154_tx_buffer_alloc(const uint8_t * p_data, uint8_t length);
+
+/**
+ * @brief Release a transmit buffer if transmission could not be requested.
+ *
+ * @param[in]  p_frame  Pointer returned by @ref nrf_802154_tx_buffer_alloc.
+ */
+void nrf_802154_tx_buffer_free(const uint8_t * p_frame);
+
+/**
+ * @brief Abort the transmission using a transmit buffer.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval true  Transmit buffers are no longer used by aborted transmission.
+ */
+bool nrf_802154_tx_buffer_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handler of the transmitted event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was transmitted.
+ */
+void nrf_802154_tx_buffer_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handler of the TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true  TX failed event should be propagated to the MAC layer.
+ */
+bool nrf_802154_tx_buffer_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TX_BUFFER_H__
@@ -0,0 +1,160 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements storage of transmit descriptors for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_tx_desc.h"
+
+#include <nrf.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_types.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_TX_EX_ENABLED
+
+static nrf_802154_tx_desc_t     NRF_802154_PER_INSTANCE(m_desc);          ///< Descriptor of the most recent extended transmission.
+static const uint8_t * volatile NRF_802154_PER_INSTANCE(mp_frame);        ///< Frame buffer described by @ref m_desc while it is transmitted.
+static const uint8_t * volatile NRF_802154_PER_INSTANCE(mp_result_frame); ///< Frame buffer described by @ref m_desc after its transmission ended.
+#define m_desc          NRF_802154_INSTANCE_OF(m_desc)
+#define mp_frame        NRF_802154_INSTANCE_OF(mp_frame)
+#define mp_result_frame NRF_802154_INSTANCE_OF(mp_result_frame)
+
+/**
+ * @brief Forget the frame buffer when its transmission ends, keeping it for result callbacks.
+ */
+static void transmission_end(void)
+{
+    const uint8_t * p_frame = mp_frame;
+
+    if (p_frame != NULL)
+    {
+        mp_result_frame = p_frame;
+        mp_frame        = NULL;
+    }
+}
+
+void nrf_802154_tx_desc_set(const nrf_802154_tx_desc_t * p_desc, const uint8_t * p_frame)
+{
+    // Make sure a preempting transmission never sees a partially copied descriptor.
+    mp_frame        = NULL;
+    mp_result_frame = NULL;
+    __DMB();
+
+    m_desc          = *p_desc;
+    m_desc.tx_power = nrf_802154_pib_tx_power_round(p_desc->tx_power);
+
+    __DMB();
+    mp_frame = p_frame;
+}
+
+void nrf_802154_tx_desc_clear(void)
+{
+    mp_frame = NULL;
+}
+
+const nrf_802154_tx_desc_t * nrf_802154_tx_desc_get(const uint8_t * p_frame)
+{
+    return ((p_frame != NULL) && (p_frame == mp_frame)) ? &m_desc : NULL;
+}
+
+const nrf_802154_tx_desc_t * nrf_802154_tx_desc_result_get(const uint8_t * p_frame)
+{
+    // Failures detected before the core is requested to transmit are notified without hooks.
+    if ((p_frame != NULL) && ((p_frame == mp_frame) || (p_frame == mp_result_frame)))
+    {
+        return &m_desc;
+    }
+
+    return NULL;
+}
+
+bool nrf_802154_tx_desc_deadline_is_met(const uint8_t * p_frame, uint32_t start_time, bool cca)
+{
+    const nrf_802154_tx_desc_t * p_desc = nrf_802154_tx_desc_get(p_frame);
+    uint32_t                     end_time;
+
+    if ((p_desc == NULL) || !(p_desc->flags & NRF_802154_TX_DESC_DEADLINE))
+    {
+        return true;
+    }
+
+    end_time = start_time + nrf_802154_tx_duration_get(p_frame[0],
+                                                       cca,
+                                                       p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT);
+
+    // Compare times modulo 2^32 to handle the timer overflow.
+    return (int32_t)(p_desc->deadline - end_time) >= 0;
+}
+
+bool nrf_802154_tx_desc_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    // Any transmission is terminated by a request with this termination level.
+    if (term_lvl >= NRF_802154_TERM_802154)
+    {
+        transmission_end();
+    }
+
+    return true;
+}
+
+void nrf_802154_tx_desc_transmitted_hook(const uint8_t * p_frame)
+{
+    if ((p_frame != NULL) && (p_frame == mp_frame))
+    {
+        transmission_end();
+    }
+}
+
+bool nrf_802154_tx_desc_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)error;
+
+    if ((p_frame != NULL) && (p_frame == mp_frame))
+    {
+        transmission_end();
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_TX_EX_ENABLED
@@ -0,0 +1,136 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_TX_DESC_H__
+#define NRF_802154_TX_DESC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tx_desc 802.15.4 driver transmit descriptors
+ * @{
+ * @ingroup nrf_802154
+ * @brief Storage of per-frame transmission parameters.
+ *
+ * The descriptor of the most recent extended transmission is stored together with a pointer to
+ * the frame buffer used by the core. Modules that configure a transmission look up the descriptor
+ * by the frame pointer, so frames transmitted without a descriptor use the driver configuration.
+ * The frame pointer is forgotten when the transmission ends, so that a later transmission of
+ * the same buffer without a descriptor is not configured by a stale descriptor.
+ */
+
+/**
+ * @brief Store the descriptor of a frame that is going to be transmitted.
+ *
+ * @param[in]  p_desc   Pointer to the transmit descriptor. The descriptor is copied.
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU passed to the core.
+ */
+void nrf_802154_tx_desc_set(const nrf_802154_tx_desc_t * p_desc, const uint8_t * p_frame);
+
+/**
+ * @brief Forget the stored descriptor if its transmission could not be requested.
+ */
+void nrf_802154_tx_desc_clear(void);
+
+/**
+ * @brief Get the descriptor of a frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU of the frame.
+ *
+ * @return  Pointer to the stored descriptor or NULL if @p p_frame was not transmitted with
+ *          a descriptor.
+ */
+const nrf_802154_tx_desc_t * nrf_802154_tx_desc_get(const uint8_t * p_frame);
+
+/**
+ * @brief Get the descriptor of a frame in a transmission result callback.
+ *
+ * Unlike @ref nrf_802154_tx_desc_get, the descriptor is available also after the transmission
+ * ended, until the next descriptor is stored.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU of the frame.
+ *
+ * @return  Pointer to the stored descriptor or NULL if @p p_frame was not transmitted with
+ *          the most recent descriptor.
+ */
+const nrf_802154_tx_desc_t * nrf_802154_tx_desc_result_get(const uint8_t * p_frame);
+
+/**
+ * @brief Check if a transmission of a frame started at given time ends before its deadline.
+ *
+ * The transmission procedure includes CCA if requested and waiting for ACK if the frame requests
+ * it.
+ *
+ * @param[in]  p_frame     Pointer to the buffer containing PHR and PSDU of the frame.
+ * @param[in]  start_time  Absolute time used by the Timer Scheduler when the transmission is
+ *                         started [us].
+ * @param[in]  cca         If CCA is performed before the transmission.
+ *
+ * @retval true   The transmission ends before the deadline or the frame has no deadline.
+ * @retval false  The transmission cannot end before the deadline.
+ */
+bool nrf_802154_tx_desc_deadline_is_met(const uint8_t * p_frame, uint32_t start_time, bool cca);
+
+/**
+ * @brief Abort the extended transmission.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval true  The descriptor is no longer used by aborted transmission.
+ */
+bool nrf_802154_tx_desc_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handler of the transmitted event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was transmitted.
+ */
+void nrf_802154_tx_desc_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handler of the TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true  TX failed event should be propagated to the MAC layer.
+ */
+bool nrf_802154_tx_desc_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TX_DESC_H__
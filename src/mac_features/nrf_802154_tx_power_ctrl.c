@@ -0,0 +1,381 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements automatic transmit power control for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_tx_power_ctrl.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_neighbor.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_TX_POWER_CTRL_ENABLED
+
+typedef struct
+{
+    nrf_802154_neighbor_id_t    id;          ///< Identity of the neighbor. Shall be the first member.
+    uint8_t                     reduction;   ///< Transmit power reduction [dB].
+    uint8_t                     acks_in_row; ///< Consecutive ACK frames received with margin above target.
+    nrf_802154_tx_power_stats_t stats;       ///< Statistics of the neighbor.
+} neighbor_t;
+
+static neighbor_t NRF_802154_PER_INSTANCE(m_neighbors)[NRF_802154_TX_POWER_CTRL_NEIGHBORS]; ///< Neighbors with controlled transmit power.
+#define m_neighbors NRF_802154_INSTANCE_OF(m_neighbors)
+
+static nrf_802154_neighbor_pending_t NRF_802154_PER_INSTANCE(m_pending);           ///< Frame waiting for ACK.
+static int8_t                        NRF_802154_PER_INSTANCE(m_pending_def_power); ///< Transmit power configured for the pending frame [dBm].
+#define m_pending           NRF_802154_INSTANCE_OF(m_pending)
+#define m_pending_def_power NRF_802154_INSTANCE_OF(m_pending_def_power)
+
+/**
+ * @brief Find a neighbor.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor.
+ * @param[in]  extended  If the given address is extended.
+ *
+ * @return  Pointer to the neighbor or NULL if it is not registered.
+ */
+static neighbor_t * neighbor_find(const uint8_t * p_addr, bool extended)
+{
+    return nrf_802154_neighbor_find(m_neighbors,
+                                    sizeof(m_neighbors[0]),
+                                    NRF_802154_TX_POWER_CTRL_NEIGHBORS,
+                                    p_addr,
+                                    extended);
+}
+
+/**
+ * @brief Calculate transmit power used for a neighbor.
+ *
+ * @param[in]  p_neighbor     Pointer to the neighbor.
+ * @param[in]  default_power  Transmit power configured in the driver [dBm].
+ *
+ * @return  Transmit power [dBm].
+ */
+static int8_t neighbor_tx_power_get(const neighbor_t * p_neighbor, int8_t default_power)
+{
+    int16_t power = (int16_t)default_power - p_neighbor->reduction;
+
+    if (power < NRF_802154_TX_POWER_CTRL_MIN_TX_POWER)
+    {
+        power = (default_power < NRF_802154_TX_POWER_CTRL_MIN_TX_POWER) ?
+                default_power : NRF_802154_TX_POWER_CTRL_MIN_TX_POWER;
+    }
+
+    return nrf_802154_pib_tx_power_round((int8_t)power);
+}
+
+/** Increase transmit power used for a neighbor by one step. */
+static void tx_power_increase(neighbor_t * p_neighbor)
+{
+    p_neighbor->reduction = (p_neighbor->reduction > NRF_802154_TX_POWER_CTRL_STEP) ?
+                            (p_neighbor->reduction - NRF_802154_TX_POWER_CTRL_STEP) : 0;
+    p_neighbor->acks_in_row = 0;
+}
+
+/** Decrease transmit power used for a neighbor by one step, unless it is already minimal. */
+static void tx_power_decrease(neighbor_t * p_neighbor, int8_t default_power)
+{
+    int16_t power = (int16_t)default_power - p_neighbor->reduction - NRF_802154_TX_POWER_CTRL_STEP;
+
+    if (power >= NRF_802154_TX_POWER_CTRL_MIN_TX_POWER)
+    {
+        p_neighbor->reduction += NRF_802154_TX_POWER_CTRL_STEP;
+    }
+
+    p_neighbor->acks_in_row = 0;
+}
+
+/**
+ * @brief Get the neighbor the pending frame was sent to and clear the pending frame.
+ *
+ * @return  Pointer to the neighbor or NULL if there is no pending frame or its destination
+ *          is not registered.
+ */
+static neighbor_t * pending_neighbor_take(void)
+{
+    nrf_802154_neighbor_id_t dst;
+
+    if (!nrf_802154_neighbor_pending_take(&m_pending, &dst))
+    {
+        return NULL;
+    }
+
+    return neighbor_find(dst.addr, dst.extended);
+}
+
+/** Update statistics of a neighbor the pending frame was transmitted to. */
+static void tx_stats_update(neighbor_t * p_neighbor)
+{
+    int8_t power = neighbor_tx_power_get(p_neighbor, m_pending_def_power);
+
+    p_neighbor->stats.tx_count++;
+    p_neighbor->stats.power_saved_sum += (uint32_t)(m_pending_def_power - power);
+}
+
+/** Handle a frame that was transmitted, but not acknowledged. */
+static void ack_missing(void)
+{
+    neighbor_t * p_neighbor = pending_neighbor_take();
+
+    if (p_neighbor != NULL)
+    {
+        tx_stats_update(p_neighbor);
+        p_neighbor->stats.no_ack_count++;
+        tx_power_increase(p_neighbor);
+    }
+}
+
+/** Register a neighbor in a free entry of the neighbor table. */
+static bool neighbor_add(const uint8_t * p_addr, bool extended)
+{
+    if (neighbor_find(p_addr, extended) != NULL)
+    {
+        return true;
+    }
+
+    for (uint8_t i = 0; i < NRF_802154_TX_POWER_CTRL_NEIGHBORS; i++)
+    {
+        neighbor_t * p_neighbor = &m_neighbors[i];
+
+        if (!p_neighbor->id.in_use)
+        {
+            memset(p_neighbor, 0, sizeof(*p_neighbor));
+            p_neighbor->stats.tx_power = nrf_802154_pib_tx_power_get();
+            nrf_802154_neighbor_id_set(&p_neighbor->id, p_addr, extended);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Unregister a neighbor from the neighbor table. */
+static bool neighbor_remove(const uint8_t * p_addr, bool extended)
+{
+    neighbor_t * p_neighbor = neighbor_find(p_addr, extended);
+
+    if (p_neighbor == NULL)
+    {
+        return false;
+    }
+
+    p_neighbor->id.in_use = false;
+
+    return true;
+}
+
+/** Copy statistics of a neighbor. */
+static bool stats_get(const uint8_t * p_addr, bool extended, nrf_802154_tx_power_stats_t * p_stats)
+{
+    neighbor_t * p_neighbor = neighbor_find(p_addr, extended);
+
+    if (p_neighbor == NULL)
+    {
+        return false;
+    }
+
+    *p_stats = p_neighbor->stats;
+
+    return true;
+}
+
+bool nrf_802154_tx_power_ctrl_neighbor_add(const uint8_t * p_addr, bool extended)
+{
+    bool result = false;
+
+    // The neighbor table is updated by the driver core in the RADIO IRQ handler.
+    if (nrf_802154_critical_section_enter())
+    {
+        result = neighbor_add(p_addr, extended);
+
+        nrf_802154_critical_section_exit();
+    }
+
+    return result;
+}
+
+bool nrf_802154_tx_power_ctrl_neighbor_remove(const uint8_t * p_addr, bool extended)
+{
+    bool result = false;
+
+    if (nrf_802154_critical_section_enter())
+    {
+        result = neighbor_remove(p_addr, extended);
+
+        nrf_802154_critical_section_exit();
+    }
+
+    return result;
+}
+
+bool nrf_802154_tx_power_ctrl_stats_get(const uint8_t               * p_addr,
+                                        bool                          extended,
+                                        nrf_802154_tx_power_stats_t * p_stats)
+{
+    bool result = false;
+
+    if (nrf_802154_critical_section_enter())
+    {
+        result = stats_get(p_addr, extended, p_stats);
+
+        nrf_802154_critical_section_exit();
+    }
+
+    return result;
+}
+
+int8_t nrf_802154_tx_power_ctrl_tx_power_get(const uint8_t * p_frame, int8_t default_power)
+{
+    const uint8_t * p_dst_addr;
+    neighbor_t    * p_neighbor;
+    bool            extended;
+    int8_t          power;
+
+    // A new transmission replaces the previous one without a result, e.g. when the higher layer
+    // terminated waiting for ACK.
+    nrf_802154_neighbor_pending_clear(&m_pending);
+
+    p_dst_addr = nrf_802154_neighbor_dst_addr_get(p_frame, &extended);
+
+    if (p_dst_addr == NULL)
+    {
+        return default_power;
+    }
+
+    p_neighbor = neighbor_find(p_dst_addr, extended);
+
+    if (p_neighbor == NULL)
+    {
+        // Unregistered neighbors are served with the configured power that is never increased.
+        return default_power;
+    }
+
+    power = neighbor_tx_power_get(p_neighbor, default_power);
+
+    p_neighbor->stats.tx_power = power;
+
+    if (p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT)
+    {
+        nrf_802154_neighbor_pending_set(&m_pending, p_frame);
+        m_pending_def_power = default_power;
+    }
+
+    return power;
+}
+
+void nrf_802154_tx_power_ctrl_ack_received(const uint8_t * p_frame, int8_t rssi)
+{
+    neighbor_t * p_neighbor;
+
+    if (p_frame != m_pending.p_frame)
+    {
+        return;
+    }
+
+    p_neighbor = pending_neighbor_take();
+
+    if (p_neighbor == NULL)
+    {
+        return;
+    }
+
+    tx_stats_update(p_neighbor);
+    p_neighbor->stats.ack_count++;
+
+    if (rssi < NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET)
+    {
+        tx_power_increase(p_neighbor);
+    }
+    else if (rssi >= NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET + NRF_802154_TX_POWER_CTRL_STEP)
+    {
+        if (++p_neighbor->acks_in_row >= NRF_802154_TX_POWER_CTRL_ACKS_TO_DECREASE)
+        {
+            tx_power_decrease(p_neighbor, m_pending_def_power);
+        }
+    }
+    else
+    {
+        // ACK is received close to the target: current transmit power is right.
+        p_neighbor->acks_in_row = 0;
+    }
+}
+
+bool nrf_802154_tx_power_ctrl_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    if ((m_pending.p_frame != NULL) && (term_lvl >= NRF_802154_TERM_802154))
+    {
+        if (req_orig == REQ_ORIG_ACK_TIMEOUT)
+        {
+            ack_missing();
+        }
+        else
+        {
+            nrf_802154_neighbor_pending_clear(&m_pending);
+        }
+    }
+
+    return true;
+}
+
+bool nrf_802154_tx_power_ctrl_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    if (p_frame == m_pending.p_frame)
+    {
+        switch (error)
+        {
+            case NRF_802154_TX_ERROR_INVALID_ACK:
+            case NRF_802154_TX_ERROR_NO_ACK:
+                ack_missing();
+                break;
+
+            default:
+                // The frame was not transmitted.
+                nrf_802154_neighbor_pending_clear(&m_pending);
+                break;
+        }
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_TX_POWER_CTRL_ENABLED
@@ -0,0 +1,132 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_TX_POWER_CTRL_H__
+#define NRF_802154_TX_POWER_CTRL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tx_power_ctrl 802.15.4 driver automatic transmit power control
+ * @{
+ * @ingroup nrf_802154
+ * @brief Per-neighbor transmit power selection based on ACK reception.
+ *
+ * For each registered neighbor the module keeps a transmit power reduction relative to the
+ * transmit power configured in the driver. The reduction grows when ACK frames are received with
+ * a margin above the RSSI target and shrinks when ACK frames are weak or missing.
+ */
+
+/**
+ * @brief Register a neighbor for automatic transmit power control.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor (little-endian).
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The neighbor is registered.
+ * @retval false  There is no space left for another neighbor or the neighbor table is being
+ *                updated by the driver.
+ */
+bool nrf_802154_tx_power_ctrl_neighbor_add(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Unregister a neighbor.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor (little-endian).
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The neighbor is unregistered.
+ * @retval false  The neighbor was not registered or the neighbor table is being updated by
+ *                the driver.
+ */
+bool nrf_802154_tx_power_ctrl_neighbor_remove(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Get statistics of a neighbor.
+ *
+ * @param[in]   p_addr    Pointer to the address of the neighbor (little-endian).
+ * @param[in]   extended  If the given address is an extended MAC address or a short MAC address.
+ * @param[out]  p_stats   Pointer to the structure filled with statistics of the neighbor.
+ *
+ * @retval true   Statistics are copied to @p p_stats.
+ * @retval false  The neighbor is not registered or the neighbor table is being updated by
+ *                the driver.
+ */
+bool nrf_802154_tx_power_ctrl_stats_get(const uint8_t               * p_addr,
+                                        bool                          extended,
+                                        nrf_802154_tx_power_stats_t * p_stats);
+
+/**
+ * @brief Get transmit power for a frame.
+ *
+ * @param[in]  p_frame        Pointer to the buffer containing PHR and PSDU of the frame to transmit.
+ * @param[in]  default_power  Transmit power configured for the frame [dBm].
+ *
+ * @return  Transmit power for the frame [dBm].
+ */
+int8_t nrf_802154_tx_power_ctrl_tx_power_get(const uint8_t * p_frame, int8_t default_power);
+
+/**
+ * @brief Handler of a received ACK frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU of the transmitted frame.
+ * @param[in]  rssi     RSSI of the received ACK frame [dBm].
+ */
+void nrf_802154_tx_power_ctrl_ack_received(const uint8_t * p_frame, int8_t rssi);
+
+/**
+ * @brief Abort the transmission that waits for ACK.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval true  Always.
+ */
+bool nrf_802154_tx_power_ctrl_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handler of the TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true  Always.
+ */
+bool nrf_802154_tx_power_ctrl_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TX_POWER_CTRL_H__
@@ -0,0 +1,200 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements scatter-gather transmission for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_tx_sg.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_TX_SG_ENABLED
+
+#define PSDU_OFFSET PHR_SIZE ///< Offset of PSDU in the transmit buffer.
+
+/// Transmit buffer containing PHR and PSDU of assembled frame.
+static uint8_t NRF_802154_PER_INSTANCE(m_tx_buffer)[PHR_SIZE + MAX_PACKET_SIZE] __ALIGN(4);
+#define m_tx_buffer NRF_802154_INSTANCE_OF(m_tx_buffer)
+
+static const nrf_802154_iovec_t * NRF_802154_PER_INSTANCE(mp_iov);      ///< Fragments of the frame in the transmit buffer.
+static uint8_t                    NRF_802154_PER_INSTANCE(m_iov_count); ///< Number of fragments pointed by @ref mp_iov.
+static volatile bool              NRF_802154_PER_INSTANCE(m_in_use);    ///< If the transmit buffer is used by a transmission.
+#define mp_iov      NRF_802154_INSTANCE_OF(mp_iov)
+#define m_iov_count NRF_802154_INSTANCE_OF(m_iov_count)
+#define m_in_use    NRF_802154_INSTANCE_OF(m_in_use)
+
+/**
+ * @brief Get length of the MAC header up to the end of addressing fields.
+ *
+ * @param[in]  p_psdu  Pointer to the PSDU containing at least Frame Control field.
+ *
+ * @return  Length of Frame Control, Sequence Number and addressing fields [bytes].
+ */
+static uint8_t mhr_addressing_length_get(const uint8_t * p_psdu)
+{
+    // Frame Control field offsets include the frame length byte.
+    uint8_t dst_mode   = p_psdu[DEST_ADDR_TYPE_OFFSET - PHR_SIZE] & DEST_ADDR_TYPE_MASK;
+    uint8_t src_mode   = p_psdu[SRC_ADDR_TYPE_OFFSET - PHR_SIZE] & SRC_ADDR_TYPE_MASK;
+    uint8_t version    = p_psdu[FRAME_VERSION_OFFSET - PHR_SIZE] & FRAME_VERSION_MASK;
+    bool    compressed = p_psdu[PAN_ID_COMPR_OFFSET - PHR_SIZE] & PAN_ID_COMPR_MASK;
+    bool    dst_pan;
+    bool    src_pan;
+    uint8_t length     = FCF_SIZE + 1;
+
+    if (version == FRAME_VERSION_2)
+    {
+        if (dst_mode == DEST_ADDR_TYPE_NONE)
+        {
+            dst_pan = (src_mode == SRC_ADDR_TYPE_NONE) && compressed;
+            src_pan = (src_mode != SRC_ADDR_TYPE_NONE) && !compressed;
+        }
+        else if (src_mode == SRC_ADDR_TYPE_NONE)
+        {
+            dst_pan = !compressed;
+            src_pan = false;
+        }
+        else if ((dst_mode == DEST_ADDR_TYPE_EXTENDED) && (src_mode == SRC_ADDR_TYPE_EXTENDED))
+        {
+            dst_pan = !compressed;
+            src_pan = false;
+        }
+        else
+        {
+            dst_pan = true;
+            src_pan = !compressed;
+        }
+    }
+    else
+    {
+        dst_pan = (dst_mode != DEST_ADDR_TYPE_NONE);
+        src_pan = (src_mode != SRC_ADDR_TYPE_NONE) && !(compressed && dst_pan);
+    }
+
+    length += dst_pan ? PAN_ID_SIZE : 0;
+    length += src_pan ? PAN_ID_SIZE : 0;
+    length += (dst_mode == DEST_ADDR_TYPE_EXTENDED) ? EXTENDED_ADDRESS_SIZE :
+              ((dst_mode == DEST_ADDR_TYPE_SHORT) ? SHORT_ADDRESS_SIZE : 0);
+    length += (src_mode == SRC_ADDR_TYPE_EXTENDED) ? EXTENDED_ADDRESS_SIZE :
+              ((src_mode == SRC_ADDR_TYPE_SHORT) ? SHORT_ADDRESS_SIZE : 0);
+
+    return length;
+}
+
+const uint8_t * nrf_802154_tx_sg_prepare(const nrf_802154_iovec_t * p_iov, uint8_t iov_count)
+{
+    uint32_t length = FCS_SIZE;
+    uint8_t  offset = PSDU_OFFSET;
+
+    assert(iov_count > 0);
+    assert(p_iov[0].length >= FCF_SIZE);
+    assert(p_iov[0].length >= mhr_addressing_length_get(p_iov[0].p_data));
+
+    for (uint8_t i = 0; i < iov_count; i++)
+    {
+        length += p_iov[i].length;
+    }
+
+    assert(length <= MAX_PACKET_SIZE);
+
+    if (m_in_use)
+    {
+        return NULL;
+    }
+
+    m_in_use    = true;
+    mp_iov      = p_iov;
+    m_iov_count = iov_count;
+
+    // The whole frame is assembled before the core parses its header and starts the radio.
+    m_tx_buffer[0] = (uint8_t)length;
+
+    for (uint8_t i = 0; i < iov_count; i++)
+    {
+        memcpy(&m_tx_buffer[offset], p_iov[i].p_data, p_iov[i].length);
+        offset += p_iov[i].length;
+    }
+
+    return m_tx_buffer;
+}
+
+void nrf_802154_tx_sg_release(void)
+{
+    m_in_use = false;
+}
+
+const nrf_802154_iovec_t * nrf_802154_tx_sg_iovec_get(const uint8_t * p_frame)
+{
+    return (p_frame == m_tx_buffer) ? mp_iov : NULL;
+}
+
+bool nrf_802154_tx_sg_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    // Any transmission is terminated by a request with this termination level.
+    if (term_lvl >= NRF_802154_TERM_802154)
+    {
+        m_in_use = false;
+    }
+
+    return true;
+}
+
+void nrf_802154_tx_sg_transmitted_hook(const uint8_t * p_frame)
+{
+    if (p_frame == m_tx_buffer)
+    {
+        m_in_use = false;
+    }
+}
+
+bool nrf_802154_tx_sg_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)error;
+
+    if (p_frame == m_tx_buffer)
+    {
+        m_in_use = false;
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_TX_SG_ENABLED
@@ -0,0 +1,108 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_TX_SG_H__
+#define NRF_802154_TX_SG_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tx_sg 802.15.4 driver scatter-gather transmission
+ * @{
+ * @ingroup nrf_802154
+ * @brief Transmission of frames stored in a list of fragments.
+ *
+ * Fragments are assembled into an internal transmit buffer before the transmission is requested.
+ * The first fragment holds the MAC header up to the end of the addressing fields, so that
+ * the header is available to the higher layer without assembling the frame.
+ */
+
+/**
+ * @brief Prepare the internal transmit buffer for transmission of given fragments.
+ *
+ * The first fragment shall contain the MAC header at least up to the end of the addressing fields.
+ *
+ * @param[in]  p_iov      Array of fragments of PSDU without FCS.
+ * @param[in]  iov_count  Number of elements in @p p_iov.
+ *
+ * @return  Pointer to the transmit buffer (PHR and PSDU) or NULL if the buffer is in use.
+ */
+const uint8_t * nrf_802154_tx_sg_prepare(const nrf_802154_iovec_t * p_iov, uint8_t iov_count);
+
+/**
+ * @brief Release the internal transmit buffer if transmission could not be requested.
+ */
+void nrf_802154_tx_sg_release(void);
+
+/**
+ * @brief Get fragments of the frame stored in the internal transmit buffer.
+ *
+ * @param[in]  p_frame  Pointer to the buffer containing PHR and PSDU of a transmitted frame.
+ *
+ * @return  Pointer to the array of fragments or NULL if @p p_frame is not the internal buffer.
+ */
+const nrf_802154_iovec_t * nrf_802154_tx_sg_iovec_get(const uint8_t * p_frame);
+
+/**
+ * @brief Abort the scatter-gather transmission.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval true  The transmit buffer is no longer used by aborted transmission.
+ */
+bool nrf_802154_tx_sg_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handler of the transmitted event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was transmitted.
+ */
+void nrf_802154_tx_sg_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handler of the TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to buffer containing PSDU of the frame that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true  TX failed event should be propagated to the MAC layer.
+ */
+bool nrf_802154_tx_sg_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TX_SG_H__
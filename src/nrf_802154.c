@@ -57,6 +57,7 @@
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_timer_coord.h"
+#include "nrf_802154_utils.h"
 #include "hal/nrf_radio.h"
 #include "platform/clock/nrf_802154_clock.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
@@ -64,8 +65,14 @@
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_ant_div_ctrl.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_gp_rx_after_tx.h"
+#include "mac_features/nrf_802154_tx_buffer.h"
+#include "mac_features/nrf_802154_tx_desc.h"
+#include "mac_features/nrf_802154_tx_power_ctrl.h"
+#include "mac_features/nrf_802154_tx_sg.h"
 
 #if ENABLE_FEM
 #include "fem/nrf_fem_control_api.h"
@@ -74,31 +81,6 @@
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
 
-#if !NRF_802154_USE_RAW_API
-/** Static transmit buffer used by @sa nrf_802154_transmit() family of functions.
- *
- * If none of functions using this buffer is called and link time optimization is enabled, this
- * buffer should be removed by linker.
- */
-static uint8_t m_tx_buffer[RAW_PAYLOAD_OFFSET + MAX_PACKET_SIZE];
-
-/**
- * @brief Fill transmit buffer with given data.
- *
- * @param[in]  p_data   Pointer to array containing payload of a data to transmit. The array
- *                      should exclude PHR or FCS fields of 802.15.4 frame.
- * @param[in]  length   Length of given frame. This value shall exclude PHR and FCS fields from
- *                      the given frame (exact size of buffer pointed by @p p_data).
- */
-static void tx_buffer_fill(const uint8_t * p_data, uint8_t length)
-{
-    assert(length <= MAX_PACKET_SIZE - FCS_SIZE);
-
-    m_tx_buffer[RAW_LENGTH_OFFSET] = length + FCS_SIZE;
-    memcpy(&m_tx_buffer[RAW_PAYLOAD_OFFSET], p_data, length);
-}
-#endif // !NRF_802154_USE_RAW_API
-
 /**
  * @brief Get timestamp of the last received frame.
  *
@@ -197,6 +179,23 @@ uint32_t nrf_802154_first_symbol_timestamp_get(uint32_t end_timestamp, uint8_t p
     return end_timestamp - (frame_symbols * PHY_US_PER_SYMBOL);
 }
 
+#if NRF_802154_MULTI_INSTANCE_ENABLED
+_Thread_local uint32_t nrf_802154_instance_id;
+
+void nrf_802154_instance_select(uint32_t instance)
+{
+    assert(instance < NRF_802154_INSTANCE_COUNT);
+
+    nrf_802154_instance_id = instance;
+}
+
+uint32_t nrf_802154_instance_get(void)
+{
+    return nrf_802154_instance_id;
+}
+
+#endif // NRF_802154_MULTI_INSTANCE_ENABLED
+
 void nrf_802154_init(void)
 {
     nrf_802154_ack_pending_bit_init();
@@ -247,6 +246,28 @@ void nrf_802154_fem_control_cfg_get(nrf_802154_fem_control_cfg_t * p_cfg)
 }
 #endif // ENABLE_FEM
 
+#if NRF_802154_COEX_ENABLED
+void nrf_802154_coex_cfg_set(const nrf_802154_coex_cfg_t * p_cfg)
+{
+    nrf_coex_control_cfg_set(p_cfg);
+}
+
+void nrf_802154_coex_cfg_get(nrf_802154_coex_cfg_t * p_cfg)
+{
+    nrf_coex_control_cfg_get(p_cfg);
+}
+
+void nrf_802154_coex_stats_get(nrf_802154_coex_stats_t * p_stats)
+{
+    nrf_coex_control_stats_get(p_stats);
+}
+
+void nrf_802154_coex_stats_reset(void)
+{
+    nrf_coex_control_stats_reset();
+}
+#endif // NRF_802154_COEX_ENABLED
+
 nrf_802154_state_t nrf_802154_state_get(void)
 {
     switch (nrf_802154_core_state_get())
@@ -331,16 +352,27 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca)
 
 bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
 {
-    bool result;
+    bool            result = false;
+    const uint8_t * p_frame;
+
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
 
-    tx_buffer_fill(p_data, length);
-    result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
-                                         REQ_ORIG_HIGHER_LAYER,
-                                         m_tx_buffer,
-                                         cca,
-                                         false,
-                                         NULL);
+    p_frame = nrf_802154_tx_buffer_alloc(p_data, length);
+
+    if (p_frame != NULL)
+    {
+        result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_HIGHER_LAYER,
+                                             p_frame,
+                                             cca,
+                                             false,
+                                             NULL);
+
+        if (!result)
+        {
+            nrf_802154_tx_buffer_free(p_frame);
+        }
+    }
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
     return result;
@@ -348,6 +380,111 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
 
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_SG_ENABLED
+
+bool nrf_802154_transmit_sg(const nrf_802154_iovec_t * p_iov, uint8_t iov_count, bool cca)
+{
+    bool            result = false;
+    const uint8_t * p_data;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+    p_data = nrf_802154_tx_sg_prepare(p_iov, iov_count);
+
+    if (p_data != NULL)
+    {
+        result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_HIGHER_LAYER,
+                                             p_data,
+                                             cca,
+                                             false,
+                                             NULL);
+
+        if (!result)
+        {
+            nrf_802154_tx_sg_release();
+        }
+    }
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
+const nrf_802154_iovec_t * nrf_802154_transmit_sg_iovec_get(const uint8_t * p_frame)
+{
+#if NRF_802154_USE_RAW_API
+    return nrf_802154_tx_sg_iovec_get(p_frame);
+#else // NRF_802154_USE_RAW_API
+    return nrf_802154_tx_sg_iovec_get(p_frame - RAW_PAYLOAD_OFFSET);
+#endif // NRF_802154_USE_RAW_API
+}
+
+#endif // NRF_802154_TX_SG_ENABLED
+
+#if NRF_802154_TX_EX_ENABLED
+
+bool nrf_802154_transmit_ex(const nrf_802154_tx_desc_t * p_desc)
+{
+    const uint8_t * p_frame;
+    bool            result = true;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+#if NRF_802154_USE_RAW_API
+    p_frame = p_desc->p_data;
+#else // NRF_802154_USE_RAW_API
+    p_frame = nrf_802154_tx_buffer_alloc(p_desc->p_data, p_desc->length);
+
+    if (p_frame == NULL)
+    {
+        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+        return false;
+    }
+#endif // NRF_802154_USE_RAW_API
+
+    nrf_802154_tx_desc_set(p_desc, p_frame);
+
+#if NRF_802154_CSMA_CA_ENABLED
+    if (p_desc->flags & NRF_802154_TX_DESC_CSMA_CA)
+    {
+        nrf_802154_csma_ca_start(p_frame);
+    }
+    else
+#endif // NRF_802154_CSMA_CA_ENABLED
+    {
+        assert(!(p_desc->flags & NRF_802154_TX_DESC_CSMA_CA));
+
+        result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_HIGHER_LAYER,
+                                             p_frame,
+                                             p_desc->cca,
+                                             false,
+                                             NULL);
+    }
+
+    if (!result)
+    {
+        nrf_802154_tx_desc_clear();
+#if !NRF_802154_USE_RAW_API
+        nrf_802154_tx_buffer_free(p_frame);
+#endif // !NRF_802154_USE_RAW_API
+    }
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
+const nrf_802154_tx_desc_t * nrf_802154_transmit_ex_desc_get(const uint8_t * p_frame)
+{
+#if NRF_802154_USE_RAW_API
+    return nrf_802154_tx_desc_result_get(p_frame);
+#else // NRF_802154_USE_RAW_API
+    return nrf_802154_tx_desc_result_get(p_frame - RAW_PAYLOAD_OFFSET);
+#endif // NRF_802154_USE_RAW_API
+}
+
+#endif // NRF_802154_TX_EX_ENABLED
+
 bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
                                 bool            cca,
                                 uint32_t        t0,
@@ -357,7 +494,17 @@ bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
     bool result;
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT_AT);
 
+#if NRF_802154_DELAYED_TRX_ENABLED
     result = nrf_802154_delayed_trx_transmit(p_data, cca, t0, dt, channel);
+#else // NRF_802154_DELAYED_TRX_ENABLED
+    (void)p_data;
+    (void)cca;
+    (void)t0;
+    (void)dt;
+    (void)channel;
+
+    result = false;
+#endif // NRF_802154_DELAYED_TRX_ENABLED
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT_AT);
     return result;
@@ -431,6 +578,41 @@ bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
     return result;
 }
 
+void nrf_802154_buffer_free_batch_raw(uint8_t * const p_data[], uint8_t count)
+{
+    bool result;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        assert(((rx_buffer_t *)p_data[i])->free == false);
+    }
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffer_free_batch(p_data, count);
+    assert(result);
+    (void)result;
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+}
+
+bool nrf_802154_buffer_free_batch_immediately_raw(uint8_t * const p_data[], uint8_t count)
+{
+    bool result;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        assert(((rx_buffer_t *)p_data[i])->free == false);
+    }
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffer_free_batch(p_data, count);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+    return result;
+}
+
 #else // NRF_802154_USE_RAW_API
 
 void nrf_802154_buffer_free(uint8_t * p_data)
@@ -466,8 +648,87 @@ bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
     return result;
 }
 
+/**
+ * @brief Convert pointers to received payloads to pointers to receive buffers.
+ *
+ * @param[in]   p_data     Array of pointers to received payloads.
+ * @param[in]   count      Number of elements in @p p_data.
+ * @param[out]  p_buffers  Array of pointers to receive buffers.
+ */
+static void buffers_from_payloads_get(uint8_t * const p_data[], uint8_t count, uint8_t * p_buffers[])
+{
+    assert(count <= RX_BUFFERS_TOTAL);
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        p_buffers[i] = p_data[i] - RAW_PAYLOAD_OFFSET;
+
+        assert(((rx_buffer_t *)p_buffers[i])->free == false);
+    }
+}
+
+void nrf_802154_buffer_free_batch(uint8_t * const p_data[], uint8_t count)
+{
+    bool      result;
+    uint8_t * p_buffers[RX_BUFFERS_TOTAL];
+
+    buffers_from_payloads_get(p_data, count, p_buffers);
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffer_free_batch(p_buffers, count);
+    assert(result);
+    (void)result;
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+}
+
+bool nrf_802154_buffer_free_batch_immediately(uint8_t * const p_data[], uint8_t count)
+{
+    bool      result;
+    uint8_t * p_buffers[RX_BUFFERS_TOTAL];
+
+    buffers_from_payloads_get(p_data, count, p_buffers);
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffer_free_batch(p_buffers, count);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+    return result;
+}
+
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+bool nrf_802154_rx_buffer_donate(uint8_t * p_buffer, uint16_t size)
+{
+    bool result;
+
+    assert(size >= sizeof(rx_buffer_t));
+    (void)size;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffer_donate(p_buffer);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+    return result;
+}
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
+void nrf_802154_rx_overflow_stats_get(nrf_802154_rx_overflow_stats_t * p_stats)
+{
+    nrf_802154_core_rx_overflow_stats_get(p_stats);
+}
+
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+uint32_t nrf_802154_irq_max_duration_get(bool reset)
+{
+    return nrf_802154_core_irq_max_duration_get(reset);
+}
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+
 int8_t nrf_802154_rssi_last_get(void)
 {
     uint8_t minus_dbm = nrf_radio_rssi_sample_get();
@@ -497,6 +758,25 @@ bool nrf_802154_auto_ack_get(void)
     return nrf_802154_pib_auto_ack_get();
 }
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
+void nrf_802154_rx_on_when_idle_set(bool enabled)
+{
+    nrf_802154_pib_rx_on_when_idle_set(enabled);
+}
+
+bool nrf_802154_rx_on_when_idle_get(void)
+{
+    return nrf_802154_pib_rx_on_when_idle_get();
+}
+
+void nrf_802154_rx_window_after_tx_set(uint32_t time)
+{
+    nrf_802154_pib_rx_window_after_tx_set(time);
+}
+
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
 bool nrf_802154_pan_coord_get(void)
 {
     return nrf_802154_pib_pan_coord_get();
@@ -557,9 +837,16 @@ void nrf_802154_transmit_csma_ca(const uint8_t * p_data, uint8_t length)
 {
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMACA);
 
-    tx_buffer_fill(p_data, length);
+    const uint8_t * p_frame = nrf_802154_tx_buffer_alloc(p_data, length);
 
-    nrf_802154_csma_ca_start(m_tx_buffer);
+    if (p_frame != NULL)
+    {
+        nrf_802154_csma_ca_start(p_frame);
+    }
+    else
+    {
+        nrf_802154_transmit_failed(p_data, NRF_802154_TX_ERROR_NO_MEM);
+    }
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
 }
@@ -576,6 +863,65 @@ void nrf_802154_ack_timeout_set(uint32_t time)
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+#if NRF_802154_TX_POWER_CTRL_ENABLED
+
+bool nrf_802154_tx_power_neighbor_add(const uint8_t * p_addr, bool extended)
+{
+    return nrf_802154_tx_power_ctrl_neighbor_add(p_addr, extended);
+}
+
+bool nrf_802154_tx_power_neighbor_remove(const uint8_t * p_addr, bool extended)
+{
+    return nrf_802154_tx_power_ctrl_neighbor_remove(p_addr, extended);
+}
+
+bool nrf_802154_tx_power_stats_get(const uint8_t               * p_addr,
+                                   bool                          extended,
+                                   nrf_802154_tx_power_stats_t * p_stats)
+{
+    return nrf_802154_tx_power_ctrl_stats_get(p_addr, extended, p_stats);
+}
+
+#endif // NRF_802154_TX_POWER_CTRL_ENABLED
+
+#if NRF_802154_ANT_DIV_ENABLED
+
+void nrf_802154_ant_div_cfg_set(const nrf_802154_ant_div_cfg_t * p_cfg)
+{
+    nrf_802154_ant_div_ctrl_cfg_set(p_cfg);
+}
+
+void nrf_802154_ant_div_cfg_get(nrf_802154_ant_div_cfg_t * p_cfg)
+{
+    nrf_802154_ant_div_ctrl_cfg_get(p_cfg);
+}
+
+void nrf_802154_ant_div_stats_get(nrf_802154_ant_div_stats_t * p_stats)
+{
+    nrf_802154_ant_div_ctrl_stats_get(p_stats);
+}
+
+void nrf_802154_ant_div_stats_reset(void)
+{
+    nrf_802154_ant_div_ctrl_stats_reset();
+}
+
+#endif // NRF_802154_ANT_DIV_ENABLED
+
+#if NRF_802154_GP_RX_AFTER_TX_ENABLED
+
+bool nrf_802154_gp_response_set(uint32_t src_id, const uint8_t * p_data)
+{
+    return nrf_802154_gp_rx_after_tx_response_add(src_id, p_data);
+}
+
+bool nrf_802154_gp_response_clear(uint32_t src_id)
+{
+    return nrf_802154_gp_rx_after_tx_response_remove(src_id);
+}
+
+#endif // NRF_802154_GP_RX_AFTER_TX_ENABLED
+
 __WEAK void nrf_802154_tx_ack_started(void)
 {
     // Intentionally empty
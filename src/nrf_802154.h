@@ -45,6 +45,11 @@
 
 #if ENABLE_FEM
 #include "fem/nrf_fem_control_api.h"
+#include "fem/nrf_fem_control_config.h"
+#endif
+
+#if NRF_802154_COEX_ENABLED
+#include "coex/nrf_coex_control_api.h"
 #endif
 
 #ifdef __cplusplus
@@ -56,6 +61,27 @@ extern "C" {
  */
 #define NRF_802154_NO_TIMESTAMP 0
 
+#if NRF_802154_MULTI_INSTANCE_ENABLED
+/**
+ * @brief Select the driver instance used by subsequent calls of the driver functions.
+ *
+ * The selected instance applies to all entry points of the driver, including its interrupt
+ * handlers and callouts. The instance shall be selected again after switching to another one.
+ * The selection is kept separately for each host thread.
+ *
+ * @param[in]  instance  Index of the instance, less than @ref NRF_802154_INSTANCE_COUNT.
+ */
+void nrf_802154_instance_select(uint32_t instance);
+
+/**
+ * @brief Get the driver instance currently selected.
+ *
+ * @return  Index of the selected instance.
+ */
+uint32_t nrf_802154_instance_get(void);
+
+#endif // NRF_802154_MULTI_INSTANCE_ENABLED
+
 /**
  * @brief Initialize the 802.15.4 driver.
  *
@@ -144,6 +170,14 @@ typedef nrf_fem_control_cfg_t nrf_802154_fem_control_cfg_t;
         .lna_gpiote_ch_id  = NRF_FEM_CONTROL_DEFAULT_LNA_GPIOTE_CHANNEL,                           \
         .ppi_ch_id_set     = NRF_FEM_CONTROL_DEFAULT_SET_PPI_CHANNEL,                              \
         .ppi_ch_id_clr     = NRF_FEM_CONTROL_DEFAULT_CLR_PPI_CHANNEL,                              \
+        .pdn_cfg = {                                                                               \
+                .enable      = 0,                                                                  \
+                .active_high = 1,                                                                  \
+                .gpio_pin    = NRF_FEM_CONTROL_DEFAULT_PDN_PIN,                                    \
+        },                                                                                         \
+        .pa_time_in_advance_us  = NRF_FEM_PA_TIME_IN_ADVANCE,                                      \
+        .lna_time_in_advance_us = NRF_FEM_LNA_TIME_IN_ADVANCE,                                     \
+        .pdn_settle_time_us     = NRF_FEM_PDN_SETTLE_TIME,                                         \
     })
 
 /**
@@ -166,6 +200,79 @@ void nrf_802154_fem_control_cfg_get(nrf_802154_fem_control_cfg_t * p_cfg);
 
 #endif // ENABLE_FEM
 
+/**
+ * @}
+ * @defgroup nrf_802154_coex Wireless coexistence management
+ * @{
+ */
+
+#if NRF_802154_COEX_ENABLED
+
+/** Structure containing run-time configuration of the packet traffic arbitration. */
+typedef nrf_coex_control_cfg_t nrf_802154_coex_cfg_t;
+
+/** Structure containing statistics of the packet traffic arbitration. */
+typedef nrf_coex_control_stats_t nrf_802154_coex_stats_t;
+
+/** Macro with default configuration of the packet traffic arbitration. */
+#define NRF_802154_COEX_DEFAULT_SETTINGS                                                           \
+    ((nrf_802154_coex_cfg_t) {                                                                     \
+        .request_cfg = {                                                                           \
+                .enable      = 1,                                                                  \
+                .active_high = 1,                                                                  \
+                .gpio_pin    = NRF_COEX_CONTROL_DEFAULT_REQUEST_PIN,                               \
+        },                                                                                         \
+        .priority_cfg = {                                                                          \
+                .enable      = 1,                                                                  \
+                .active_high = 1,                                                                  \
+                .gpio_pin    = NRF_COEX_CONTROL_DEFAULT_PRIORITY_PIN,                              \
+        },                                                                                         \
+        .grant_cfg = {                                                                             \
+                .enable      = 1,                                                                  \
+                .active_high = 1,                                                                  \
+                .gpio_pin    = NRF_COEX_CONTROL_DEFAULT_GRANT_PIN,                                 \
+        },                                                                                         \
+        .request_gpiote_ch_id  = NRF_COEX_CONTROL_DEFAULT_REQUEST_GPIOTE_CHANNEL,                  \
+        .priority_gpiote_ch_id = NRF_COEX_CONTROL_DEFAULT_PRIORITY_GPIOTE_CHANNEL,                 \
+        .ppi_ch_id_clr         = NRF_COEX_CONTROL_DEFAULT_CLR_PPI_CHANNEL,                         \
+        .tx_high_priority      = false,                                                            \
+        .request_to_grant_time_us = NRF_COEX_CONTROL_DEFAULT_REQUEST_TO_GRANT_TIME,                \
+    })
+
+/**
+ * @brief Set packet traffic arbitration configuration.
+ *
+ * @note This function shall not be called when the radio is in use.
+ *
+ * @param[in] p_cfg A pointer to the packet traffic arbitration configuration.
+ *
+ */
+void nrf_802154_coex_cfg_set(const nrf_802154_coex_cfg_t * p_cfg);
+
+/**
+ * @brief Get packet traffic arbitration configuration.
+ *
+ * @param[out] p_cfg A pointer to the structure for the packet traffic arbitration configuration.
+ *
+ */
+void nrf_802154_coex_cfg_get(nrf_802154_coex_cfg_t * p_cfg);
+
+/**
+ * @brief Get numbers of granted and denied requests of the medium.
+ *
+ * @param[out] p_stats A pointer to the structure for the statistics.
+ *
+ */
+void nrf_802154_coex_stats_get(nrf_802154_coex_stats_t * p_stats);
+
+/**
+ * @brief Reset statistics of the packet traffic arbitration.
+ *
+ */
+void nrf_802154_coex_stats_reset(void);
+
+#endif // NRF_802154_COEX_ENABLED
+
 
 /**
  * @} 
@@ -337,8 +444,9 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
  * @note If the CPU is halted or interrupted while this function is executed, 
  *       @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed must be called before this
  *       function returns a result.
- * @note This function copies the given buffer. It maintains an internal buffer, which is used to
- *       make a frame copy. To prevent unnecessary memory consumption and to perform zero-copy
+ * @note This function copies the given buffer. It maintains a pool of @ref NRF_802154_TX_BUFFERS
+ *       internal buffers, which are used to make frame copies. A buffer is released when the
+ *       transmission ends. To prevent unnecessary memory consumption and to perform zero-copy
  *       transmission, use @ref nrf_802154_transmit_raw instead.
  *
  * In transmit state, the radio transmits a given frame. If requested, it waits for an ACK frame.
@@ -366,12 +474,102 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
  * @param[in]  cca     If the driver should perform a CCA procedure before transmission.
  *
  * @retval  true   If the transmission procedure was scheduled.
- * @retval  false  If the driver could not schedule the transmission procedure.
+ * @retval  false  If the driver could not schedule the transmission procedure or all internal
+ *                 transmit buffers are in use.
  */
 bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
 
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_SG_ENABLED
+
+/**
+ * @brief Change radio state to transmit a frame stored in a list of fragments.
+ *
+ * The driver assembles the fragments into an internal transmit buffer before the transmission is
+ * requested, so the higher layer does not need to keep an assembled copy of the frame.
+ *
+ * The transmission result is reported to the higher layer like for @ref nrf_802154_transmit_raw
+ * (or @ref nrf_802154_transmit). The frame pointer passed to the callbacks points to the internal
+ * transmit buffer. Use @ref nrf_802154_transmit_sg_iovec_get to get the original fragments.
+ *
+ * @note The array of fragments and the fragments themselves shall stay valid until the
+ *       transmission result is notified.
+ * @note This function shall not be called from multiple contexts at the same time.
+ *
+ * @param[in]  p_iov      Array of fragments of PSDU without FCS. The first fragment shall contain
+ *                        the MAC header at least up to the end of the addressing fields.
+ * @param[in]  iov_count  Number of elements in @p p_iov.
+ * @param[in]  cca        If the driver should perform a CCA procedure before transmission.
+ *
+ * @retval  true   If the transmission procedure was scheduled.
+ * @retval  false  If the driver could not schedule the transmission procedure or the internal
+ *                 transmit buffer is still used by a previous transmission.
+ */
+bool nrf_802154_transmit_sg(const nrf_802154_iovec_t * p_iov, uint8_t iov_count, bool cca);
+
+/**
+ * @brief Get fragments of a frame transmitted with @ref nrf_802154_transmit_sg.
+ *
+ * @note This function shall be called from the transmission result callback, before the next
+ *       call to @ref nrf_802154_transmit_sg.
+ *
+ * @param[in]  p_frame  Frame pointer passed to the transmission result callback.
+ *
+ * @return  Pointer to the array of fragments passed to @ref nrf_802154_transmit_sg or NULL if
+ *          @p p_frame was not transmitted with @ref nrf_802154_transmit_sg.
+ */
+const nrf_802154_iovec_t * nrf_802154_transmit_sg_iovec_get(const uint8_t * p_frame);
+
+#endif // NRF_802154_TX_SG_ENABLED
+
+#if NRF_802154_TX_EX_ENABLED
+
+/**
+ * @brief Change radio state to transmit a frame described by a transmit descriptor.
+ *
+ * Transmit power, channel, CCA configuration and ACK time-out selected by
+ * @ref nrf_802154_tx_desc_t::flags are used for this frame only. The radio is configured for the
+ * frame by the driver core when the transmission starts, so no additional requests are issued.
+ * Parameters that are not overridden are taken from the driver configuration, which is restored
+ * when the next operation starts.
+ *
+ * If @ref NRF_802154_TX_DESC_CSMA_CA is set, the frame is transmitted using the CSMA-CA procedure
+ * with backoff parameters from the descriptor (see @ref nrf_802154_transmit_csma_ca_raw). Otherwise
+ * the frame is transmitted like with @ref nrf_802154_transmit_raw (or @ref nrf_802154_transmit).
+ *
+ * If @ref NRF_802154_TX_DESC_DEADLINE is set, the frame is dropped with
+ * @ref NRF_802154_TX_ERROR_DEADLINE as soon as the transmission procedure (including CCA and
+ * waiting for ACK) started after the next CSMA-CA backoff or after the next granted timeslot
+ * could not end before @ref nrf_802154_tx_desc_t::deadline.
+ *
+ * The descriptor is copied by this function. Use @ref nrf_802154_transmit_ex_desc_get in the
+ * transmission result callbacks to get the copy, including the user context.
+ *
+ * @note Only the descriptor of the most recent call is stored.
+ * @note A channel change requested during the transmission takes precedence over the channel
+ *       from the descriptor.
+ *
+ * @param[in]  p_desc  Pointer to the transmit descriptor.
+ *
+ * @retval  true   If the transmission procedure was scheduled.
+ * @retval  false  If the driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_ex(const nrf_802154_tx_desc_t * p_desc);
+
+/**
+ * @brief Get the descriptor of a frame transmitted with @ref nrf_802154_transmit_ex.
+ *
+ * @param[in]  p_frame  Frame pointer passed to the transmission result callback.
+ *
+ * @return  Pointer to the copy of the descriptor passed to @ref nrf_802154_transmit_ex or NULL
+ *          if @p p_frame was not transmitted with the most recent call to
+ *          @ref nrf_802154_transmit_ex.
+ */
+const nrf_802154_tx_desc_t * nrf_802154_transmit_ex_desc_get(const uint8_t * p_frame);
+
+#endif // NRF_802154_TX_EX_ENABLED
+
 /**
  * @brief Request transmission at specified time.
  *
@@ -389,6 +587,8 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
  * If the requested transmission time is in the past, the function returns false and does not
  * schedule transmission.
  *
+ * @note If @ref NRF_802154_DELAYED_TRX_ENABLED is disabled, the function always returns false.
+ *
  * @param[in]  p_data   Pointer to array containing data to transmit. First byte should contain frame
  *                      length (including PHR and FCS). Following bytes should contain data. CRC is
  *                      computed automatically by radio hardware. Therefore, the FCS field can
@@ -455,6 +655,51 @@ bool nrf_802154_cca(void);
  */
 bool nrf_802154_continuous_carrier(void);
 
+/**
+ * @}
+ * @defgroup nrf_802154_rx_off_when_idle Receiver state after transmission
+ * @{
+ */
+
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
+/**
+ * @brief Enable or disable receiver when the radio is idle.
+ *
+ * @note Receiver is enabled when idle by default.
+ *
+ * If enabled, the radio enters receive state when a transmission procedure ends. If disabled, the
+ * radio falls asleep directly when a transmission procedure ends (after the ACK frame is received
+ * if it was requested), or after the receive window set by
+ * @ref nrf_802154_rx_window_after_tx_set. This way a sleepy end device does not keep its receiver
+ * enabled until the next higher layer calls @ref nrf_802154_sleep.
+ *
+ * @param[in]  enabled  If receiver should be enabled when the radio is idle.
+ */
+void nrf_802154_rx_on_when_idle_set(bool enabled);
+
+/**
+ * @brief Check if receiver is enabled when the radio is idle.
+ *
+ * @retval  true   Receiver is enabled when the radio is idle.
+ * @retval  false  The radio falls asleep when a transmission procedure ends.
+ */
+bool nrf_802154_rx_on_when_idle_get(void);
+
+/**
+ * @brief Set the length of the receive window opened after transmission.
+ *
+ * The receive window is used only if receiver is disabled when the radio is idle. The radio
+ * falls asleep when the window expires unless a frame is being received or the next higher
+ * layer requested another operation in the meantime.
+ *
+ * @param[in]  time  Length of the receive window in us. 0 (default) means that the radio falls
+ *                   asleep directly after transmission.
+ */
+void nrf_802154_rx_window_after_tx_set(uint32_t time);
+
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
 
 /**
  * @}
@@ -790,6 +1035,39 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data);
  */
 bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data);
 
+/**
+ * @brief Notify the driver that the buffers containing the received frames are not used anymore.
+ *
+ * All buffers are returned to the driver with a single request and the receiver is restarted
+ * at most once.
+ *
+ * @note The buffers pointed to by @p p_data may be modified by this function.
+ * @note This function can be safely called only from the main context. To free the buffers from
+ *       a callback or IRQ context, use @ref nrf_802154_buffer_free_batch_immediately_raw.
+ *
+ * @param[in]  p_data  Array of pointers to the buffers containing the received data that are no
+ *                     longer needed by the higher layer.
+ * @param[in]  count   Number of elements in @p p_data.
+ */
+void nrf_802154_buffer_free_batch_raw(uint8_t * const p_data[], uint8_t count);
+
+/**
+ * @brief Notify the driver that the buffers containing the received frames are not used anymore.
+ *
+ * @note The buffers pointed to by @p p_data may be modified by this function.
+ * @note This function can be safely called from any context. If the driver is busy processing
+ *       a request called from a context with lower priority, this function returns false and
+ *       the caller should free the buffers later.
+ *
+ * @param[in]  p_data  Array of pointers to the buffers containing the received data that are no
+ *                     longer needed by the higher layer.
+ * @param[in]  count   Number of elements in @p p_data.
+ *
+ * @retval true   Buffers were freed successfully.
+ * @retval false  Buffers cannot be freed right now due to ongoing operation.
+ */
+bool nrf_802154_buffer_free_batch_immediately_raw(uint8_t * const p_data[], uint8_t count);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -820,8 +1098,95 @@ void nrf_802154_buffer_free(uint8_t * p_data);
  */
 bool nrf_802154_buffer_free_immediately(uint8_t * p_data);
 
+/**
+ * @brief Notify the driver that the buffers containing the received frames are not used anymore.
+ *
+ * All buffers are returned to the driver with a single request and the receiver is restarted
+ * at most once.
+ *
+ * @note The buffers pointed to by @p p_data may be modified by this function.
+ * @note This function can be safely called only from the main context. To free the buffers from
+ *       a callback or IRQ context, use @ref nrf_802154_buffer_free_batch_immediately.
+ *
+ * @param[in]  p_data  Array of pointers to the buffers containing the received data that are no
+ *                     longer needed by the higher layer.
+ * @param[in]  count   Number of elements in @p p_data. It shall not exceed
+ *                     @ref NRF_802154_RX_BUFFERS.
+ */
+void nrf_802154_buffer_free_batch(uint8_t * const p_data[], uint8_t count);
+
+/**
+ * @brief Notify the driver that the buffers containing the received frames are not used anymore.
+ *
+ * @note The buffers pointed to by @p p_data may be modified by this function.
+ * @note This function can be safely called from any context. If the driver is busy processing
+ *       a request called from a context with lower priority, this function returns false and
+ *       the caller should free the buffers later.
+ *
+ * @param[in]  p_data  Array of pointers to the buffers containing the received data that are no
+ *                     longer needed by the higher layer.
+ * @param[in]  count   Number of elements in @p p_data. It shall not exceed
+ *                     @ref NRF_802154_RX_BUFFERS.
+ *
+ * @retval true   Buffers were freed successfully.
+ * @retval false  Buffers cannot be freed right now due to ongoing operation.
+ */
+bool nrf_802154_buffer_free_batch_immediately(uint8_t * const p_data[], uint8_t count);
+
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+
+/**
+ * @brief Donate a buffer owned by the higher layer to receive a frame to.
+ *
+ * A frame is received directly to the donated buffer by the RADIO peripheral. The driver hands
+ * the buffer back with the received frame notification: the pointer passed to
+ * @ref nrf_802154_received_raw is @p p_buffer (or @p p_buffer + 1 passed to
+ * @ref nrf_802154_received if RAW API is disabled). Such buffer must not be passed to
+ * @ref nrf_802154_buffer_free_raw or @ref nrf_802154_buffer_free. To receive to it again, donate
+ * it again.
+ *
+ * @note The buffer must be placed in Data RAM accessible by EasyDMA.
+ * @note Donated buffers are used only when all buffers owned by the driver are in use.
+ *
+ * @param[in]  p_buffer  Pointer to the donated buffer.
+ * @param[in]  size      Size of the donated buffer. It shall be at least
+ *                       @c MAX_PACKET_SIZE + 2 bytes: PHR, PSDU and one byte used by the driver.
+ *
+ * @retval true   The buffer was accepted by the driver.
+ * @retval false  The driver already holds @ref NRF_802154_RX_DONATED_BUFFERS donated buffers.
+ */
+bool nrf_802154_rx_buffer_donate(uint8_t * p_buffer, uint16_t size);
+
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
+/**
+ * @brief Get statistics of receive buffer overflows.
+ *
+ * Counters are updated according to @ref NRF_802154_RX_OVERFLOW_POLICY.
+ *
+ * @param[out]  p_stats  Pointer to the structure filled with the statistics.
+ */
+void nrf_802154_rx_overflow_stats_get(nrf_802154_rx_overflow_stats_t * p_stats);
+
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+
+/**
+ * @brief Get the longest execution time of the RADIO IRQ handler.
+ *
+ * The RADIO IRQ handler runs at @ref NRF_802154_IRQ_PRIORITY. This value shows how long the driver
+ * may block other code running at this priority, e.g. with and without
+ * @ref NRF_802154_IRQ_BOTTOM_HALF_ENABLED.
+ *
+ * @param[in]  reset  If the measurement should be restarted.
+ *
+ * @returns  The longest execution time since initialization or last reset [CPU cycles].
+ */
+uint32_t nrf_802154_irq_max_duration_get(bool reset);
+
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+
 
 /**
  * @}
@@ -1046,6 +1411,9 @@ void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data);
  * @note Before the CSMA-CA procedure is used, the application should initialize a random seed with
  *       srand.
  *
+ * @note If all internal transmit buffers are in use, @ref nrf_802154_transmit_failed is called
+ *       with @ref NRF_802154_TX_ERROR_NO_MEM before this function returns.
+ *
  * @param[in]  p_data    Pointer to the frame to transmit. See also @ref nrf_802154_transmit.
  * @param[in]  length    Length of the given frame. See also @ref nrf_802154_transmit.
  */
@@ -1074,6 +1442,183 @@ void nrf_802154_ack_timeout_set(uint32_t time);
 
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_tx_power Automatic transmit power control
+ * @{
+ */
+#if NRF_802154_TX_POWER_CTRL_ENABLED
+
+/**
+ * @brief Enable automatic transmit power control for frames sent to a neighbor.
+ *
+ * Frames addressed to the neighbor are transmitted with the lowest transmit power that keeps
+ * ACK frames received above @ref NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET. The power is never
+ * higher than the power set by @ref nrf_802154_tx_power_set.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor (little-endian).
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The neighbor is registered.
+ * @retval false  There is no space left for another neighbor or the neighbor table is being
+ *                updated by the driver
+ *                (see @ref NRF_802154_TX_POWER_CTRL_NEIGHBORS).
+ */
+bool nrf_802154_tx_power_neighbor_add(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Disable automatic transmit power control for frames sent to a neighbor.
+ *
+ * @param[in]  p_addr    Pointer to the address of the neighbor (little-endian).
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The neighbor is unregistered.
+ * @retval false  The neighbor was not registered or the neighbor table is being updated by
+ *                the driver.
+ */
+bool nrf_802154_tx_power_neighbor_remove(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Get statistics of automatic transmit power control for a neighbor.
+ *
+ * The average transmit power saving is equal to @ref nrf_802154_tx_power_stats_t::power_saved_sum
+ * divided by @ref nrf_802154_tx_power_stats_t::tx_count.
+ *
+ * @param[in]   p_addr    Pointer to the address of the neighbor (little-endian).
+ * @param[in]   extended  If the given address is an extended MAC address or a short MAC address.
+ * @param[out]  p_stats   Pointer to the structure filled with statistics of the neighbor.
+ *
+ * @retval true   Statistics are copied to @p p_stats.
+ * @retval false  The neighbor is not registered or the neighbor table is being updated by
+ *                the driver.
+ */
+bool nrf_802154_tx_power_stats_get(const uint8_t               * p_addr,
+                                   bool                          extended,
+                                   nrf_802154_tx_power_stats_t * p_stats);
+
+#endif // NRF_802154_TX_POWER_CTRL_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_ant_div Antenna diversity
+ * @{
+ */
+#if NRF_802154_ANT_DIV_ENABLED
+
+/**
+ * @brief Configure the pin that selects one of two antennas.
+ *
+ * When enabled, the driver receives with the antenna that has better average RSSI and transmits
+ * frames to a neighbor with the antenna that last received a frame from it. The low level of
+ * the pin selects @ref NRF_802154_ANT_DIV_ANTENNA_1 and the high level selects
+ * @ref NRF_802154_ANT_DIV_ANTENNA_2.
+ *
+ * @param[in]  p_cfg  Pointer to the antenna select pin configuration.
+ */
+void nrf_802154_ant_div_cfg_set(const nrf_802154_ant_div_cfg_t * p_cfg);
+
+/**
+ * @brief Get configuration of the pin that selects one of two antennas.
+ *
+ * @param[out]  p_cfg  Pointer to the structure filled with the configuration.
+ */
+void nrf_802154_ant_div_cfg_get(nrf_802154_ant_div_cfg_t * p_cfg);
+
+/**
+ * @brief Get statistics of antenna selection.
+ *
+ * @param[out]  p_stats  Pointer to the structure filled with the statistics.
+ */
+void nrf_802154_ant_div_stats_get(nrf_802154_ant_div_stats_t * p_stats);
+
+/**
+ * @brief Reset statistics of antenna selection.
+ */
+void nrf_802154_ant_div_stats_reset(void);
+
+#endif // NRF_802154_ANT_DIV_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_gp Green Power response transmission
+ * @{
+ */
+#if NRF_802154_GP_RX_AFTER_TX_ENABLED
+#if NRF_802154_USE_RAW_API
+
+/**
+ * @brief Register a response to be sent to a Green Power Device (GPD) after its next frame.
+ *
+ * When the driver receives a frame from the GPD with the RxAfterTx bit set, it transmits
+ * the response @ref NRF_802154_GP_RX_AFTER_TX_OFFSET after the end of that frame, on the channel
+ * the frame was received on. The response is then unregistered. The result of the transmission is
+ * reported by @ref nrf_802154_transmitted_raw or @ref nrf_802154_transmit_failed, like a frame
+ * transmitted with @ref nrf_802154_transmit_raw_at.
+ *
+ * If the response cannot be scheduled, e.g. because a delayed transmission requested by the higher
+ * layer is in progress, @ref nrf_802154_transmit_failed is called with
+ * @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED. The response can be registered again to be sent after
+ * the next frame of the GPD.
+ *
+ * @note The buffer pointed by @p p_data must stay valid until the result of the transmission is
+ *       reported or the response is removed by @ref nrf_802154_gp_response_clear.
+ *
+ * @param[in]  src_id  Source ID of the GPD.
+ * @param[in]  p_data  Pointer to array containing PHR and PSDU of the response. CRC is computed
+ *                     automatically by radio hardware. Therefore, the FCS field can contain any
+ *                     bytes.
+ *
+ * @retval true   The response is registered.
+ * @retval false  There is no space left for another response
+ *                (see @ref NRF_802154_GP_RX_AFTER_TX_RESPONSES).
+ */
+bool nrf_802154_gp_response_set(uint32_t src_id, const uint8_t * p_data);
+
+#else // NRF_802154_USE_RAW_API
+
+/**
+ * @brief Register a response to be sent to a Green Power Device (GPD) after its next frame.
+ *
+ * When the driver receives a frame from the GPD with the RxAfterTx bit set, it transmits
+ * the response @ref NRF_802154_GP_RX_AFTER_TX_OFFSET after the end of that frame, on the channel
+ * the frame was received on. The response is then unregistered. The result of the transmission is
+ * reported by @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed, like a frame
+ * transmitted with @ref nrf_802154_transmit_raw_at. These functions get a pointer to the PSDU
+ * of the response, that is @p p_data + 1.
+ *
+ * If the response cannot be scheduled, e.g. because a delayed transmission requested by the higher
+ * layer is in progress, @ref nrf_802154_transmit_failed is called with
+ * @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED. The response can be registered again to be sent after
+ * the next frame of the GPD.
+ *
+ * @note The buffer pointed by @p p_data must stay valid until the result of the transmission is
+ *       reported or the response is removed by @ref nrf_802154_gp_response_clear.
+ *
+ * @param[in]  src_id  Source ID of the GPD.
+ * @param[in]  p_data  Pointer to array containing PHR and PSDU of the response. CRC is computed
+ *                     automatically by radio hardware. Therefore, the FCS field can contain any
+ *                     bytes.
+ *
+ * @retval true   The response is registered.
+ * @retval false  There is no space left for another response
+ *                (see @ref NRF_802154_GP_RX_AFTER_TX_RESPONSES).
+ */
+bool nrf_802154_gp_response_set(uint32_t src_id, const uint8_t * p_data);
+
+#endif // NRF_802154_USE_RAW_API
+
+/**
+ * @brief Remove the response registered for a Green Power Device.
+ *
+ * @param[in]  src_id  Source ID of the GPD.
+ *
+ * @retval true   The response is removed.
+ * @retval false  There was no response registered for the GPD.
+ */
+bool nrf_802154_gp_response_clear(uint32_t src_id);
+
+#endif // NRF_802154_GP_RX_AFTER_TX_ENABLED
+
 /** @} */
 
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
 
 #include "hal/nrf_radio.h"
 
@@ -55,15 +56,20 @@
 #define UNUSED_PENDING_EXTENDED_ADDRESS ((uint8_t [EXTENDED_ADDRESS_SIZE]) {0})
 
 /// If pending bit in ACK frame should be set to valid or default value.
-static bool m_setting_pending_bit_enabled;
+static bool NRF_802154_PER_INSTANCE(m_setting_pending_bit_enabled);
+#define m_setting_pending_bit_enabled NRF_802154_INSTANCE_OF(m_setting_pending_bit_enabled)
 /// Array of Short Addresses of nodes for which there is pending data in the buffer.
-static uint8_t m_pending_short[NUM_PENDING_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];
+static uint8_t NRF_802154_PER_INSTANCE(m_pending_short)[NUM_PENDING_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];
+#define m_pending_short NRF_802154_INSTANCE_OF(m_pending_short)
 /// Array of Extended Addresses of nodes for which there is pending data in the buffer.
-static uint8_t m_pending_extended[NUM_PENDING_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE];
+static uint8_t NRF_802154_PER_INSTANCE(m_pending_extended)[NUM_PENDING_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE];
+#define m_pending_extended NRF_802154_INSTANCE_OF(m_pending_extended)
 /// Current number of Short Addresses of nodes for which there is pending data in the buffer.
-static uint8_t m_num_of_pending_short;
+static uint8_t NRF_802154_PER_INSTANCE(m_num_of_pending_short);
+#define m_num_of_pending_short NRF_802154_INSTANCE_OF(m_num_of_pending_short)
 /// Current number of Extended Addresses of nodes for which there is pending data in the buffer.
-static uint8_t m_num_of_pending_extended;
+static uint8_t NRF_802154_PER_INSTANCE(m_num_of_pending_extended);
+#define m_num_of_pending_extended NRF_802154_INSTANCE_OF(m_num_of_pending_extended)
 
 /**
  * @brief Compare two extended addresses.
@@ -75,6 +81,7 @@ static uint8_t m_num_of_pending_extended;
  * @retval  0  First address is equal to the second address.
  * @retval  1  First address is greater than the second address.
  */
+NRF_802154_RAM_CODE
 static int8_t extended_addr_compare(const uint8_t * p_first_addr, const uint8_t * p_second_addr)
 {
     uint32_t first_addr;
@@ -109,6 +116,7 @@ static int8_t extended_addr_compare(const uint8_t * p_first_addr, const uint8_t
  * @retval  0  First address is equal to the second address.
  * @retval  1  First address is greater than the second address.
  */
+NRF_802154_RAM_CODE
 static int8_t short_addr_compare(const uint8_t * p_first_addr, const uint8_t * p_second_addr)
 {
     uint16_t first_addr  = *(uint16_t *)(p_first_addr);
@@ -139,6 +147,7 @@ static int8_t short_addr_compare(const uint8_t * p_first_addr, const uint8_t * p
  * @retval  0  First address is equal to the second address.
  * @retval  1  First address is greater than the second address.
  */
+NRF_802154_RAM_CODE
 static int8_t addr_compare(const uint8_t * p_first_addr, const uint8_t * p_second_addr, bool extended)
 {
     if (extended)
@@ -164,6 +173,7 @@ static int8_t addr_compare(const uint8_t * p_first_addr, const uint8_t * p_secon
  * @retval true   Address @p p_addr is in the list.
  * @retval false  Address @p p_addr is not in the list.
  */
+NRF_802154_RAM_CODE
 static bool addr_binary_search(const uint8_t * p_addr,
                                const uint8_t * p_addr_array,
                                uint8_t       * p_location,
@@ -363,6 +373,7 @@ void nrf_802154_ack_pending_bit_for_addr_reset(bool extended)
     }
 }
 
+NRF_802154_RAM_CODE
 bool nrf_802154_ack_pending_bit_should_be_set(const uint8_t * p_psdu)
 {
     const uint8_t * p_src_addr;
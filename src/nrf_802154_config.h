@@ -48,6 +48,97 @@ extern "C" {
  * @brief Configuration of the 802.15.4 radio driver for nRF SoCs.
  */
 
+/**
+ * @defgroup nrf_802154_config_profile Device profile configuration
+ * @{
+ */
+
+#define NRF_802154_DEVICE_PROFILE_CUSTOM  0 ///< Each feature is configured separately.
+#define NRF_802154_DEVICE_PROFILE_RFD     1 ///< Reduced-function device: an end device that transmits to its coordinator.
+#define NRF_802154_DEVICE_PROFILE_FFD     2 ///< Full-function device: a coordinator or a router.
+#define NRF_802154_DEVICE_PROFILE_SNIFFER 3 ///< Receive-only device capturing frames for analysis.
+
+/**
+ * @def NRF_802154_DEVICE_PROFILE
+ *
+ * Profile of the device that sets coherent defaults of the feature switches of the driver. The
+ * features not needed by the profile are removed from the build. Each of the switches set by
+ * a profile can still be overridden in the project configuration.
+ *
+ * - RFD: no energy detection, stand-alone CCA, continuous carrier and delayed operations, and a
+ *   single entry in each list of addresses with pending data.
+ * - FFD: all MAC features except the continuous carrier test mode.
+ * - Sniffer: receiver only, without CSMA-CA, ACK time-out, delayed operations, energy detection,
+ *   stand-alone CCA and continuous carrier, and with a single entry in each list of addresses with
+ *   pending data.
+ *
+ */
+#ifndef NRF_802154_DEVICE_PROFILE
+#define NRF_802154_DEVICE_PROFILE NRF_802154_DEVICE_PROFILE_CUSTOM
+#endif
+
+#if NRF_802154_DEVICE_PROFILE == NRF_802154_DEVICE_PROFILE_RFD
+
+#ifndef NRF_802154_ENERGY_DETECTION_ENABLED
+#define NRF_802154_ENERGY_DETECTION_ENABLED 0
+#endif
+#ifndef NRF_802154_CCA_PROCEDURE_ENABLED
+#define NRF_802154_CCA_PROCEDURE_ENABLED 0
+#endif
+#ifndef NRF_802154_CONTINUOUS_CARRIER_ENABLED
+#define NRF_802154_CONTINUOUS_CARRIER_ENABLED 0
+#endif
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 0
+#endif
+#ifndef NRF_802154_PENDING_SHORT_ADDRESSES
+#define NRF_802154_PENDING_SHORT_ADDRESSES 1
+#endif
+#ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES 1
+#endif
+
+#elif NRF_802154_DEVICE_PROFILE == NRF_802154_DEVICE_PROFILE_FFD
+
+#ifndef NRF_802154_CONTINUOUS_CARRIER_ENABLED
+#define NRF_802154_CONTINUOUS_CARRIER_ENABLED 0
+#endif
+
+#elif NRF_802154_DEVICE_PROFILE == NRF_802154_DEVICE_PROFILE_SNIFFER
+
+#ifndef NRF_802154_ENERGY_DETECTION_ENABLED
+#define NRF_802154_ENERGY_DETECTION_ENABLED 0
+#endif
+#ifndef NRF_802154_CCA_PROCEDURE_ENABLED
+#define NRF_802154_CCA_PROCEDURE_ENABLED 0
+#endif
+#ifndef NRF_802154_CONTINUOUS_CARRIER_ENABLED
+#define NRF_802154_CONTINUOUS_CARRIER_ENABLED 0
+#endif
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 0
+#endif
+#ifndef NRF_802154_CSMA_CA_ENABLED
+#define NRF_802154_CSMA_CA_ENABLED 0
+#endif
+#ifndef NRF_802154_ACK_TIMEOUT_ENABLED
+#define NRF_802154_ACK_TIMEOUT_ENABLED 0
+#endif
+#ifndef NRF_802154_PENDING_SHORT_ADDRESSES
+#define NRF_802154_PENDING_SHORT_ADDRESSES 1
+#endif
+#ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES 1
+#endif
+
+#elif NRF_802154_DEVICE_PROFILE != NRF_802154_DEVICE_PROFILE_CUSTOM
+#error "Unsupported NRF_802154_DEVICE_PROFILE"
+#endif // NRF_802154_DEVICE_PROFILE
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup nrf_802154_config_radio Radio driver configuration
  * @{
@@ -192,6 +283,80 @@ extern "C" {
 #define NRF_802154_SWI_PRIORITY 5
 #endif
 
+/**
+ * @def NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+ *
+ * If processing of received frames that is not timing-critical should be deferred from the RADIO
+ * IRQ handler to the SWI handler. The RADIO IRQ handler only samples data of a received frame
+ * that changes with the next frame (RSSI, timestamp, selected antenna). RSSI and LQI corrections,
+ * antenna diversity learning, Green Power response matching and the reception notifications,
+ * including reception failures, are done in order in the SWI handler triggered by the SWI EGU.
+ *
+ * @note This option requires the driver to use SWI to process requests and notifications.
+ *
+ */
+#ifndef NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+#define NRF_802154_IRQ_BOTTOM_HALF_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+ *
+ * If the driver should measure the longest execution time of the RADIO IRQ handler with the DWT
+ * cycle counter (see @ref nrf_802154_irq_max_duration_get).
+ *
+ */
+#ifndef NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+#define NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RAM_CODE_ENABLED
+ *
+ * If the timing-critical part of the driver (the RADIO IRQ handler path, frame filtering, pending
+ * bit lookup and the Timer Scheduler) and its lookup tables should be executed from RAM to avoid
+ * flash wait states and cache misses. Rarely taken error paths are moved out of line.
+ *
+ * The code is placed in the .ramfunc.nrf_802154 section (IAR: __ramfunc), which the linker script
+ * must place in the initialized data output section to be copied to RAM by the startup code. The
+ * tables are placed in the .data.nrf_802154_ram_data section. The RAM cost can be read from the
+ * map file and the latency gain with @ref NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED.
+ *
+ */
+#ifndef NRF_802154_RAM_CODE_ENABLED
+#define NRF_802154_RAM_CODE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_MULTI_INSTANCE_ENABLED
+ *
+ * If the driver state should be kept separately for @ref NRF_802154_INSTANCE_COUNT instances of
+ * the driver, so that many radios can be simulated in one host process. The instance used by the
+ * driver is selected with @ref nrf_802154_instance_select before calling any of its entry points.
+ *
+ * @note This option is intended for host builds only. It requires a compiler supporting C11
+ *       @c _Thread_local and the GNU range designated initializer extension (GCC or Clang).
+ *       When disabled the driver state is kept in plain static variables.
+ *
+ */
+#ifndef NRF_802154_MULTI_INSTANCE_ENABLED
+#define NRF_802154_MULTI_INSTANCE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_INSTANCE_COUNT
+ *
+ * Number of driver instances if @ref NRF_802154_MULTI_INSTANCE_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_INSTANCE_COUNT
+#if NRF_802154_MULTI_INSTANCE_ENABLED
+#define NRF_802154_INSTANCE_COUNT 2
+#else
+#define NRF_802154_INSTANCE_COUNT 1
+#endif
+#endif
+
 /**
  * @def NRF_802154_USE_RAW_API
  *
@@ -206,6 +371,22 @@ extern "C" {
 #define NRF_802154_USE_RAW_API 1
 #endif
 
+/**
+ * @def NRF_802154_TX_BUFFERS
+ *
+ * Number of internal transmit buffers used by the API that copies frames
+ * (@ref NRF_802154_USE_RAW_API disabled).
+ *
+ * A buffer is owned by the driver until the transmission ends. The buffers are allocated
+ * round-robin, so the frame reported by @ref nrf_802154_transmitted or
+ * @ref nrf_802154_transmit_failed is not overwritten if the next frame is requested from
+ * the notification.
+ *
+ */
+#ifndef NRF_802154_TX_BUFFERS
+#define NRF_802154_TX_BUFFERS 2
+#endif
+
 /**
  * @def NRF_802154_PENDING_SHORT_ADDRESSES
  *
@@ -236,6 +417,61 @@ extern "C" {
 #define NRF_802154_RX_BUFFERS  16
 #endif
 
+/**
+ * @def NRF_802154_RX_BUFFER_DONATION_ENABLED
+ *
+ * If the higher layer can donate its own buffers to receive frames to.
+ *
+ * Donated buffers are used when all driver-owned buffers are in use. A frame is received directly
+ * to a donated buffer and ownership of the buffer returns to the higher layer with the received
+ * frame notification. This allows to avoid copying received frames to the higher layer message
+ * pool and to reduce @ref NRF_802154_RX_BUFFERS down to 0.
+ *
+ */
+#ifndef NRF_802154_RX_BUFFER_DONATION_ENABLED
+#define NRF_802154_RX_BUFFER_DONATION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RX_DONATED_BUFFERS
+ *
+ * Maximal number of donated buffers held by the driver at the same time.
+ *
+ * @note This option is used only if @ref NRF_802154_RX_BUFFER_DONATION_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_RX_DONATED_BUFFERS
+#define NRF_802154_RX_DONATED_BUFFERS 4
+#endif
+
+#define NRF_802154_RX_OVERFLOW_POLICY_NONE             0 ///< Receiver waits for a buffer to be freed.
+#define NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER 1 ///< Reserved buffer receives MAC command frames.
+#define NRF_802154_RX_OVERFLOW_POLICY_DROP_BROADCAST   2 ///< Oldest undelivered broadcast frame is dropped.
+
+/**
+ * @def NRF_802154_RX_OVERFLOW_POLICY
+ *
+ * Action taken when all receive buffers are in use.
+ *
+ * With @ref NRF_802154_RX_OVERFLOW_POLICY_NONE the receiver stays idle until the higher layer
+ * frees a buffer. Frames destined to this node are not acknowledged in the meantime.
+ *
+ * With @ref NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER one additional buffer is reserved. It
+ * is used only when no other buffer is available and accepts only MAC command frames (including
+ * Data Requests). Other frames are dropped before they are acknowledged.
+ *
+ * With @ref NRF_802154_RX_OVERFLOW_POLICY_DROP_BROADCAST the buffer of the oldest broadcast frame
+ * that was received but not yet delivered to the higher layer is reused. This policy requires
+ * notifications to be delivered through SWI; with direct notifications no frame is undelivered
+ * and the receiver behaves as with @ref NRF_802154_RX_OVERFLOW_POLICY_NONE.
+ *
+ * Frames dropped due to each policy are counted. See @ref nrf_802154_rx_overflow_stats_get.
+ *
+ */
+#ifndef NRF_802154_RX_OVERFLOW_POLICY
+#define NRF_802154_RX_OVERFLOW_POLICY NRF_802154_RX_OVERFLOW_POLICY_NONE
+#endif
+
 /**
  * @def NRF_802154_DISABLE_BCC_MATCHING
  *
@@ -282,6 +518,68 @@ extern "C" {
 #define NRF_802154_DELAYED_TRX_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+ *
+ * If ramp up of a delayed transmission should be started by the High Precision Timer through PPI.
+ * When enabled, the frame transmission starts within 1 us of the requested time instead of
+ * being subject to the Low Power Timer granularity and interrupt latency.
+ *
+ * @note This feature requires @ref NRF_802154_DELAYED_TRX_ENABLED and
+ *       @ref NRF_802154_FRAME_TIMESTAMP_ENABLED. It cannot be used with the SoftDevice RAAL,
+ *       which shares the High Precision Timer.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+#define NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_LIGHT_SLEEP_ENABLED
+ *
+ * If the RADIO peripheral configuration should be retained while the driver sleeps.
+ * When enabled, the RADIO is not power-cycled when entering sleep and is not reconfigured
+ * on wake-up, unless another user of the peripheral changed its configuration in the meantime.
+ * It shortens the wake-up procedure at the cost of leaving the RADIO peripheral powered.
+ *
+ */
+#ifndef NRF_802154_LIGHT_SLEEP_ENABLED
+#define NRF_802154_LIGHT_SLEEP_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_DETECTION_ENABLED
+ *
+ * If the Energy Detection procedure is available. When disabled, the ED state is removed from the
+ * core FSM and energy detection requests are rejected.
+ *
+ */
+#ifndef NRF_802154_ENERGY_DETECTION_ENABLED
+#define NRF_802154_ENERGY_DETECTION_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_CCA_PROCEDURE_ENABLED
+ *
+ * If the stand-alone CCA procedure is available. When disabled, the CCA state is removed from the
+ * core FSM and CCA requests are rejected. CCA performed before transmission is not affected.
+ *
+ */
+#ifndef NRF_802154_CCA_PROCEDURE_ENABLED
+#define NRF_802154_CCA_PROCEDURE_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_CONTINUOUS_CARRIER_ENABLED
+ *
+ * If the continuous carrier test mode is available. When disabled, the continuous carrier state
+ * is removed from the core FSM and continuous carrier requests are rejected.
+ *
+ */
+#ifndef NRF_802154_CONTINUOUS_CARRIER_ENABLED
+#define NRF_802154_CONTINUOUS_CARRIER_ENABLED 1
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_clock Clock driver configuration
@@ -314,6 +612,62 @@ extern "C" {
 #define NRF_802154_CLOCK_LFCLK_SOURCE NRF_CLOCK_LFCLK_Xtal
 #endif
 
+/**
+ * @def NRF_802154_HFCLK_PREWARM_ENABLED
+ *
+ * If the Radio Scheduler should learn the startup time of the high-frequency clock and use it
+ * to request preconditions of delayed timeslots just in time, instead of using the worst-case
+ * ramp-up time.
+ *
+ */
+#ifndef NRF_802154_HFCLK_PREWARM_ENABLED
+#define NRF_802154_HFCLK_PREWARM_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_HFCLK_STARTUP_PERCENTILE
+ *
+ * Percentile of measured high-frequency clock startup times used as the learned startup time [%].
+ * The default value uses the longest measured startup time. With a lower value the corresponding
+ * share of delayed timeslots may start before the clock is ready.
+ *
+ * @note This configuration is only applicable if @ref NRF_802154_HFCLK_PREWARM_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_HFCLK_STARTUP_PERCENTILE
+#define NRF_802154_HFCLK_STARTUP_PERCENTILE 100
+#endif
+
+/**
+ * @def NRF_802154_HFCLK_STARTUP_MARGIN
+ *
+ * Time added to the learned high-frequency clock startup time to get the ramp-up time of all
+ * preconditions of a delayed timeslot [us]. It covers the other preconditions, like entering
+ * continuous mode of the radio arbiter.
+ *
+ * @note This configuration is only applicable if @ref NRF_802154_HFCLK_PREWARM_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_HFCLK_STARTUP_MARGIN
+#define NRF_802154_HFCLK_STARTUP_MARGIN 50
+#endif
+
+/**
+ * @def NRF_802154_HFCLK_BREAK_EVEN_TIME
+ *
+ * Time for which the high-frequency clock is kept running after the Radio Scheduler releases it [us].
+ *
+ * If the clock is requested again within this time, it is approved immediately without waiting
+ * for the crystal to start up. This time should be set to the idle gap for which keeping
+ * the clock running costs as much energy as restarting it. Set to 0 to stop the clock immediately.
+ *
+ * @note This configuration is only applicable if @ref NRF_802154_HFCLK_PREWARM_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_HFCLK_BREAK_EVEN_TIME
+#define NRF_802154_HFCLK_BREAK_EVEN_TIME 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_rtc RTC driver configuration
@@ -373,6 +727,23 @@ extern "C" {
 #define NRF_802154_RTC_IRQN  RTC2_IRQn
 #endif
 
+/**
+ * @def NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+ *
+ * If the Timer Scheduler should use the High Precision Timer to expire timers with microsecond
+ * accuracy while the HP timer is running and synchronized. Otherwise, timers are expired by
+ * the Low Power Timer.
+ *
+ * @note The HP timer interrupt uses @ref NRF_802154_RTC_IRQ_PRIORITY.
+ * @note This feature requires @ref NRF_802154_FRAME_TIMESTAMP_ENABLED. It cannot be used with
+ *       the SoftDevice RAAL or together with @ref NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED,
+ *       because the HP timer has no other spare compare channel.
+ *
+ */
+#ifndef NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+#define NRF_802154_TIMER_SCHED_HP_LANE_ENABLED 0
+#endif
+
 
 /**
  * @}
@@ -450,6 +821,256 @@ extern "C" {
 #define NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT 7000
 #endif
 
+/**
+ * @def NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+ *
+ * If frames other than the expected ACK received while waiting for ACK should be kept.
+ *
+ * If enabled, a frame with a valid CRC that passes filtering is notified as a received frame and
+ * the driver keeps waiting for ACK. Waiting ends when the expected ACK is received, the ACK
+ * time-out expires or the higher layer requests another operation.
+ *
+ * @note Frames kept this way are never acknowledged, even if they request an ACK. The driver
+ *       cannot transmit the ACK on time, because the TIMER is not synchronized with the end of
+ *       such a frame. The originator retransmits the frame, so the higher layer shall discard
+ *       the duplicate by its sequence number.
+ *
+ * If disabled, any frame received while waiting for ACK ends the procedure with
+ * @ref NRF_802154_TX_ERROR_INVALID_ACK and the frame is dropped.
+ *
+ */
+#ifndef NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+#define NRF_802154_RX_DURING_ACK_WAIT_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_rx_window Receive window after transmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+ *
+ * If the driver should support disabling the receiver when idle
+ * (@ref nrf_802154_rx_on_when_idle_set), with an optional receive window after transmission
+ * (@ref nrf_802154_rx_window_after_tx_set).
+ *
+ * If disabled, the radio always enters receive state when a transmission procedure ends.
+ *
+ */
+#ifndef NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+#define NRF_802154_RX_WINDOW_AFTER_TX_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_gp_rx_after_tx Green Power response feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_GP_RX_AFTER_TX_ENABLED
+ *
+ * If the driver should transmit responses registered with @ref nrf_802154_gp_response_set in
+ * the receive window that a Green Power Device opens after its transmission. This feature requires
+ * @ref NRF_802154_DELAYED_TRX_ENABLED and @ref NRF_802154_FRAME_TIMESTAMP_ENABLED.
+ *
+ */
+#ifndef NRF_802154_GP_RX_AFTER_TX_ENABLED
+#define NRF_802154_GP_RX_AFTER_TX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_GP_RX_AFTER_TX_RESPONSES
+ *
+ * Number of Green Power Devices for which a response can be registered at the same time.
+ *
+ */
+#ifndef NRF_802154_GP_RX_AFTER_TX_RESPONSES
+#define NRF_802154_GP_RX_AFTER_TX_RESPONSES 4
+#endif
+
+/**
+ * @def NRF_802154_GP_RX_AFTER_TX_OFFSET
+ *
+ * Time from the end of a received Green Power Device Frame (GPDF) to the start of the response
+ * transmission [us].
+ *
+ */
+#ifndef NRF_802154_GP_RX_AFTER_TX_OFFSET
+#define NRF_802154_GP_RX_AFTER_TX_OFFSET 20000
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_sg Scatter-gather transmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_SG_ENABLED
+ *
+ * If the driver should provide @ref nrf_802154_transmit_sg to transmit frames stored in a list
+ * of fragments. Enabling this feature reserves an internal transmit buffer.
+ *
+ */
+#ifndef NRF_802154_TX_SG_ENABLED
+#define NRF_802154_TX_SG_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_ex Extended transmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_EX_ENABLED
+ *
+ * If the driver should provide @ref nrf_802154_transmit_ex to transmit frames with per-frame
+ * transmit power, channel, CCA configuration, CSMA-CA parameters and ACK time-out. Parameters
+ * overridden for a frame are restored from the driver configuration when the next operation
+ * starts.
+ *
+ */
+#ifndef NRF_802154_TX_EX_ENABLED
+#define NRF_802154_TX_EX_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_power_ctrl Automatic transmit power control feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_ENABLED
+ *
+ * If the driver should adjust transmit power of frames sent to neighbors registered with
+ * @ref nrf_802154_tx_power_neighbor_add. For each neighbor the driver uses the lowest transmit
+ * power that keeps ACK frames received above @ref NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_ENABLED
+#define NRF_802154_TX_POWER_CTRL_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_NEIGHBORS
+ *
+ * Number of neighbors for which the driver can control transmit power.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_NEIGHBORS
+#define NRF_802154_TX_POWER_CTRL_NEIGHBORS 8
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET
+ *
+ * Lowest RSSI of ACK frames considered a reliable link [dBm]. Transmit power is increased if
+ * ACK frames are received below this level.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET
+#define NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET (-80)
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_STEP
+ *
+ * Transmit power is changed by this value at once [dB].
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_STEP
+#define NRF_802154_TX_POWER_CTRL_STEP 4
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_MIN_TX_POWER
+ *
+ * Lowest transmit power used by the automatic transmit power control [dBm].
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_MIN_TX_POWER
+#define NRF_802154_TX_POWER_CTRL_MIN_TX_POWER (-20)
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CTRL_ACKS_TO_DECREASE
+ *
+ * Number of consecutive ACK frames received with sufficient margin above
+ * @ref NRF_802154_TX_POWER_CTRL_ACK_RSSI_TARGET before transmit power is decreased.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CTRL_ACKS_TO_DECREASE
+#define NRF_802154_TX_POWER_CTRL_ACKS_TO_DECREASE 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_ant_div Antenna diversity feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_ANT_DIV_ENABLED
+ *
+ * If the driver should select one of two antennas for each reception and transmission using
+ * an RF switch controlled by a GPIO configured with @ref nrf_802154_ant_div_cfg_set.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_ENABLED
+#define NRF_802154_ANT_DIV_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_NEIGHBORS
+ *
+ * Number of neighbors for which the driver remembers the antenna that last received a frame
+ * from them. The least recently heard neighbor is replaced when the table is full.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_NEIGHBORS
+#define NRF_802154_ANT_DIV_NEIGHBORS 8
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_EXPLORE_PERIOD
+ *
+ * Number of frames received with the preferred antenna after which the receiver listens with
+ * the other antenna for one frame to refresh its RSSI estimate.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_EXPLORE_PERIOD
+#define NRF_802154_ANT_DIV_EXPLORE_PERIOD 16
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_coex Wireless coexistence feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_COEX_ENABLED
+ *
+ * If the driver should arbitrate the medium with a co-located radio using packet traffic
+ * arbitration (PTA) REQUEST, PRIORITY and GRANT lines. Transmissions denied by the arbiter are
+ * not started. CSMA-CA backs off and retries such transmissions.
+ *
+ * @note The ramp-up of a frame is delayed by the request-to-grant time of the arbiter. The driver
+ *       waits for the ramp-up to sample GRANT, so the handler that starts the transmission
+ *       is extended by this time. Compare channel 3 of @ref NRF_802154_TIMER_INSTANCE schedules
+ *       the ramp-up. This feature cannot be used together with
+ *       @ref NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED.
+ *
+ */
+#ifndef NRF_802154_COEX_ENABLED
+#define NRF_802154_COEX_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
@@ -55,14 +55,23 @@
 #include "nrf_802154_rsch.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_swi.h"
 #include "nrf_802154_timer_coord.h"
 #include "nrf_802154_types.h"
+#include "nrf_802154_utils.h"
+#include "coex/nrf_coex_control_api.h"
 #include "fem/nrf_fem_control_api.h"
 #include "hal/nrf_egu.h"
 #include "hal/nrf_ppi.h"
 #include "hal/nrf_radio.h"
 #include "hal/nrf_timer.h"
+#include "mac_features/nrf_802154_ant_div_ctrl.h"
 #include "mac_features/nrf_802154_filter.h"
+#include "mac_features/nrf_802154_gp_rx_after_tx.h"
+#include "mac_features/nrf_802154_tx_desc.h"
+#include "mac_features/nrf_802154_tx_power_ctrl.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #include "nrf_802154_core_hooks.h"
 
@@ -76,6 +85,7 @@
 #define PPI_CH4             NRF_PPI_CHANNEL10
 #define PPI_CH5             NRF_PPI_CHANNEL11
 #define PPI_CH6             NRF_PPI_CHANNEL12
+#define PPI_CH7             NRF_PPI_CHANNEL15
 #define PPI_CHGRP0          NRF_PPI_CHANNEL_GROUP0  ///< PPI group used to disable self-disabling PPIs
 #define PPI_CHGRP0_DIS_TASK NRF_PPI_TASK_CHG0_DIS
 
@@ -92,6 +102,16 @@
 #define PPI_CRCERROR_COUNTER_CLEAR  PPI_CH6  ///< PPI that connects RADIO CRCERROR event with TIMER CLEAR task
 #endif // NRF_802154_DISABLE_BCC_MATCHING
 
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+#define PPI_HP_TIMER_EGU            PPI_CH7  ///< PPI that connects HP timer trigger event with EGU task
+
+#define TX_TRIGGER_MARGIN           10       ///< Minimal time between arming and firing of the HP timer trigger [us].
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+
+#if NRF_802154_COEX_ENABLED && NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+#error "Coexistence arbitration cannot be used with the High Precision Timer trigger"
+#endif
+
 /// Workaround for missing PHYEND event in older chip revision.
 static inline uint32_t short_phyend_disable_mask_get(void)
 {
@@ -160,6 +180,8 @@ static inline uint32_t short_phyend_disable_mask_get(void)
 
 #define MAX_CRIT_SECT_TIME 60  ///< Maximal time that the driver spends in single critical section.
 
+#define COEX_GRANT_WAIT_MARGIN 100 ///< Margin of the wait for the coexistence ramp-up TIMER compare, that covers LP timer granularity [us].
+
 #define LQI_VALUE_FACTOR 4     ///< Factor needed to calculate LQI value based on data from RADIO peripheral
 #define LQI_MAX          0xff  ///< Maximal LQI value
 
@@ -169,20 +191,79 @@ static inline uint32_t short_phyend_disable_mask_get(void)
  */
 #define RX_FRAME_LQI(psdu)  ((psdu)[(psdu)[0] - 1])
 
-#if NRF_802154_RX_BUFFERS > 1
+#if (NRF_802154_RX_BUFFERS != 1) || (RX_BUFFERS_TOTAL > 1) || NRF_802154_MULTI_INSTANCE_ENABLED
 /// Pointer to currently used receive buffer.
-static rx_buffer_t * mp_current_rx_buffer;
+static rx_buffer_t * NRF_802154_PER_INSTANCE(mp_current_rx_buffer);
+#define mp_current_rx_buffer NRF_802154_INSTANCE_OF(mp_current_rx_buffer)
 #else
 /// If there is only one buffer use const pointer to the receive buffer.
 static rx_buffer_t * const mp_current_rx_buffer = &nrf_802154_rx_buffers[0];
 #endif
 
-static uint8_t         m_ack_psdu[ACK_LENGTH + 1]; ///< Ack frame buffer.
-static const uint8_t * mp_tx_data;                 ///< Pointer to data to transmit.
-static uint32_t        m_ed_time_left;             ///< Remaining time of current energy detection procedure [us].
-static uint8_t         m_ed_result;                ///< Result of current energy detection procedure.
+static uint8_t         NRF_802154_PER_INSTANCE(m_ack_psdu)[ACK_LENGTH + 1]; ///< Ack frame buffer.
+static const uint8_t * NRF_802154_PER_INSTANCE(mp_tx_data);                 ///< Pointer to data to transmit.
+#define m_ack_psdu NRF_802154_INSTANCE_OF(m_ack_psdu)
+#define mp_tx_data NRF_802154_INSTANCE_OF(mp_tx_data)
+#if NRF_802154_ENERGY_DETECTION_ENABLED
+static uint32_t        NRF_802154_PER_INSTANCE(m_ed_time_left); ///< Remaining time of current energy detection procedure [us].
+static uint8_t         NRF_802154_PER_INSTANCE(m_ed_result);    ///< Result of current energy detection procedure.
+#define m_ed_time_left NRF_802154_INSTANCE_OF(m_ed_time_left)
+#define m_ed_result    NRF_802154_INSTANCE_OF(m_ed_result)
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
+
+static nrf_802154_rx_overflow_stats_t NRF_802154_PER_INSTANCE(m_rx_overflow_stats); ///< Statistics of receive buffer overflows.
+static bool                           NRF_802154_PER_INSTANCE(m_rx_overflow);       ///< If the receiver ran out of regular receive buffers.
+#define m_rx_overflow_stats NRF_802154_INSTANCE_OF(m_rx_overflow_stats)
+#define m_rx_overflow       NRF_802154_INSTANCE_OF(m_rx_overflow)
+
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+/** Size of the RADIO IRQ bottom half queue.
+ *
+ * One slot for each receive buffer, one for reception failure, and one slot to distinguish full
+ * queue from empty one.
+ */
+#define BH_RX_QUEUE_SIZE (RX_BUFFERS_TOTAL + 2)
 
-static volatile radio_state_t m_state;             ///< State of the radio driver
+/// Data of an accepted frame captured for the processing deferred to the RADIO IRQ bottom half.
+typedef struct
+{
+    const uint8_t              * p_psdu;          ///< Pointer to the accepted frame or NULL.
+    uint8_t                      rssi_sample;     ///< Uncorrected RSSISAMPLE of the frame.
+#if NRF_802154_ANT_DIV_ENABLED
+    nrf_802154_ant_div_antenna_t antenna;         ///< Antenna that received the frame.
+#endif // NRF_802154_ANT_DIV_ENABLED
+#if NRF_802154_GP_RX_AFTER_TX_ENABLED
+    bool                         timestamp_valid; ///< If @ref timestamp is valid.
+    uint32_t                     timestamp;       ///< Timestamp of the frame.
+#endif // NRF_802154_GP_RX_AFTER_TX_ENABLED
+} bh_rx_accepted_t;
+
+/// Reception result which processing is deferred to the RADIO IRQ bottom half.
+typedef struct
+{
+    uint8_t             * p_psdu;      ///< Pointer to the received frame or NULL if reception failed.
+    uint8_t               rssi_sample; ///< Uncorrected RSSISAMPLE of the frame.
+    nrf_802154_rx_error_t error;       ///< Cause of failed reception.
+    bh_rx_accepted_t      accepted;    ///< Data captured when the frame was accepted.
+} bh_rx_event_t;
+
+static bh_rx_event_t    NRF_802154_PER_INSTANCE(m_bh_rx_queue)[BH_RX_QUEUE_SIZE]; ///< Reception results waiting for the bottom half.
+static volatile uint8_t NRF_802154_PER_INSTANCE(m_bh_rx_r_ptr);                   ///< Read index of @ref m_bh_rx_queue.
+static volatile uint8_t NRF_802154_PER_INSTANCE(m_bh_rx_w_ptr);                   ///< Write index of @ref m_bh_rx_queue.
+static bh_rx_accepted_t NRF_802154_PER_INSTANCE(m_bh_rx_accepted);                ///< Data of the last accepted frame that is not notified yet.
+#define m_bh_rx_queue    NRF_802154_INSTANCE_OF(m_bh_rx_queue)
+#define m_bh_rx_r_ptr    NRF_802154_INSTANCE_OF(m_bh_rx_r_ptr)
+#define m_bh_rx_w_ptr    NRF_802154_INSTANCE_OF(m_bh_rx_w_ptr)
+#define m_bh_rx_accepted NRF_802154_INSTANCE_OF(m_bh_rx_accepted)
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+static volatile uint32_t NRF_802154_PER_INSTANCE(m_irq_max_duration); ///< Longest execution time of the RADIO IRQ handler [CPU cycles].
+#define m_irq_max_duration NRF_802154_INSTANCE_OF(m_irq_max_duration)
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+
+static volatile radio_state_t NRF_802154_PER_INSTANCE(m_state); ///< State of the radio driver
+#define m_state NRF_802154_INSTANCE_OF(m_state)
 
 typedef struct
 {
@@ -195,9 +276,28 @@ typedef struct
     bool tx_started            :1;  ///< If requested transmission has started.
 #endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
 } nrf_802154_flags_t;
-static nrf_802154_flags_t m_flags;  ///< Flags used to store current driver state.
+static nrf_802154_flags_t NRF_802154_PER_INSTANCE(m_flags); ///< Flags used to store current driver state.
+#define m_flags NRF_802154_INSTANCE_OF(m_flags)
+
+static volatile bool NRF_802154_PER_INSTANCE(m_rsch_timeslot_is_granted); ///< State of the RSCH timeslot.
+#define m_rsch_timeslot_is_granted NRF_802154_INSTANCE_OF(m_rsch_timeslot_is_granted)
 
-static volatile bool m_rsch_timeslot_is_granted;  ///< State of the RSCH timeslot.
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+static bool NRF_802154_PER_INSTANCE(m_radio_cfg_retained); ///< If RADIO configuration was retained during sleep.
+#define m_radio_cfg_retained NRF_802154_INSTANCE_OF(m_radio_cfg_retained)
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+static volatile bool NRF_802154_PER_INSTANCE(m_tx_trigger_is_set); ///< If ramp up of the next transmission is triggered by HP timer.
+static uint32_t      NRF_802154_PER_INSTANCE(m_tx_trigger_time);   ///< Absolute time of the ramp up of the next transmission [us].
+#define m_tx_trigger_is_set NRF_802154_INSTANCE_OF(m_tx_trigger_is_set)
+#define m_tx_trigger_time   NRF_802154_INSTANCE_OF(m_tx_trigger_time)
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+
+#if NRF_802154_TX_EX_ENABLED
+static bool NRF_802154_PER_INSTANCE(m_tx_desc_applied); ///< If channel or CCA configuration of a transmit descriptor is set in RADIO.
+#define m_tx_desc_applied NRF_802154_INSTANCE_OF(m_tx_desc_applied)
+#endif // NRF_802154_TX_EX_ENABLED
 
 /***************************************************************************************************
  * @section Common core operations
@@ -224,19 +324,28 @@ static void rx_flags_clear(void)
 #endif // !NRF_802154_DISABLE_BCC_MATCHING
 }
 
-/** Get result of last RSSI measurement.
+/** Convert RSSISAMPLE value to RSSI.
  *
- * @returns  Result of last RSSI measurement [dBm].
+ * @param[in]  rssi_sample  Value read from RSSISAMPLE register.
+ *
+ * @returns  RSSI corrected by a temperature factor [dBm].
  */
-static int8_t rssi_last_measurement_get(void)
+static int8_t rssi_from_sample_get(uint8_t rssi_sample)
 {
-    uint8_t rssi_sample = nrf_radio_rssi_sample_get();
-
     rssi_sample = nrf_802154_rssi_sample_corrected_get(rssi_sample);
 
     return -((int8_t)rssi_sample);
 }
 
+/** Get result of last RSSI measurement.
+ *
+ * @returns  Result of last RSSI measurement [dBm].
+ */
+static int8_t rssi_last_measurement_get(void)
+{
+    return rssi_from_sample_get(nrf_radio_rssi_sample_get());
+}
+
 /** Get LQI of a received frame.
  *
  * @param[in]  p_data  Pointer to buffer containing PHR and PSDU of received frame
@@ -258,11 +367,90 @@ static uint8_t lqi_get(const uint8_t * p_data)
     return (uint8_t)lqi;
 }
 
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+/** Get the next free slot of the bottom half queue. */
+static bh_rx_event_t * bh_rx_event_enter(void)
+{
+    assert(((m_bh_rx_w_ptr + 1) % BH_RX_QUEUE_SIZE) != m_bh_rx_r_ptr);
+
+    return &m_bh_rx_queue[m_bh_rx_w_ptr];
+}
+
+/** Commit the slot returned by @ref bh_rx_event_enter and trigger the bottom half. */
+static void bh_rx_event_exit(void)
+{
+    __DMB();
+    m_bh_rx_w_ptr = (m_bh_rx_w_ptr + 1) % BH_RX_QUEUE_SIZE;
+
+    nrf_802154_swi_irq_bottom_half_trigger();
+}
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+
+/** Process a frame that passed filtering (or any frame in promiscuous mode).
+ *
+ * This processing is not needed to transmit ACK. It is deferred to the bottom half if it is
+ * enabled.
+ *
+ * @param[in]  p_psdu  Pointer to buffer containing PHR and PSDU of received frame.
+ */
+static void rx_frame_accepted(const uint8_t * p_psdu)
+{
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+    // Sample data that changes with the next frame. The rest is done when the frame is notified.
+    m_bh_rx_accepted.p_psdu      = p_psdu;
+    m_bh_rx_accepted.rssi_sample = nrf_radio_rssi_sample_get();
+#if NRF_802154_ANT_DIV_ENABLED
+    m_bh_rx_accepted.antenna = nrf_802154_ant_div_ctrl_antenna_get();
+#endif // NRF_802154_ANT_DIV_ENABLED
+#if NRF_802154_GP_RX_AFTER_TX_ENABLED
+    m_bh_rx_accepted.timestamp_valid =
+        nrf_802154_timer_coord_timestamp_get(&m_bh_rx_accepted.timestamp);
+#endif // NRF_802154_GP_RX_AFTER_TX_ENABLED
+
+#else // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+#if NRF_802154_ANT_DIV_ENABLED
+    nrf_802154_ant_div_ctrl_frame_received(p_psdu,
+                                           rssi_last_measurement_get(),
+                                           nrf_802154_ant_div_ctrl_antenna_get());
+#endif // NRF_802154_ANT_DIV_ENABLED
+
+#if NRF_802154_GP_RX_AFTER_TX_ENABLED
+    uint32_t timestamp;
+
+    // Timestamp of this frame is available until the next frame is received.
+    if (nrf_802154_timer_coord_timestamp_get(&timestamp))
+    {
+        nrf_802154_gp_rx_after_tx_frame_received(p_psdu, timestamp);
+    }
+#endif // NRF_802154_GP_RX_AFTER_TX_ENABLED
+
+    (void)p_psdu;
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+}
+
 static void received_frame_notify(uint8_t * p_psdu)
 {
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+    // RSSISAMPLE is overwritten by the next frame. Sample it now and defer the rest.
+    bh_rx_event_t * p_event = bh_rx_event_enter();
+
+    p_event->p_psdu      = p_psdu;
+    p_event->rssi_sample = nrf_radio_rssi_sample_get();
+    p_event->accepted    = m_bh_rx_accepted;
+
+    if (p_event->accepted.p_psdu != p_psdu)
+    {
+        p_event->accepted.p_psdu = NULL;
+    }
+
+    m_bh_rx_accepted.p_psdu = NULL;
+
+    bh_rx_event_exit();
+#else // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
     nrf_802154_notify_received(p_psdu,                       // data
                                rssi_last_measurement_get(),  // rssi
                                lqi_get(p_psdu));             // lqi
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
 }
 
 /** Allow nesting critical sections and notify MAC layer that a frame was received. */
@@ -278,9 +466,25 @@ static void received_frame_notify_and_nesting_allow(uint8_t * p_psdu)
 /** Notify MAC layer that receive procedure failed. */
 static void receive_failed_notify(nrf_802154_rx_error_t error)
 {
-    nrf_802154_critical_section_nesting_allow();
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+    // Keep the order of notifications of received frames and failures.
+    bh_rx_event_t * p_event = bh_rx_event_enter();
+
+    p_event->p_psdu = NULL;
+    p_event->error  = error;
 
+    bh_rx_event_exit();
+#else // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
     nrf_802154_notify_receive_failed(error);
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+}
+
+/** Allow nesting critical sections and notify MAC layer that receive procedure failed. */
+static void receive_failed_notify_and_nesting_allow(nrf_802154_rx_error_t error)
+{
+    nrf_802154_critical_section_nesting_allow();
+
+    receive_failed_notify(error);
 
     nrf_802154_critical_section_nesting_deny();
 }
@@ -302,8 +506,17 @@ static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, int8_t lqi)
 {
     const uint8_t * p_frame = mp_tx_data;
 
+    nrf_coex_control_release();
+
     nrf_802154_critical_section_nesting_allow();
 
+#if NRF_802154_TX_POWER_CTRL_ENABLED
+    if (p_ack != NULL)
+    {
+        nrf_802154_tx_power_ctrl_ack_received(p_frame, power);
+    }
+#endif // NRF_802154_TX_POWER_CTRL_ENABLED
+
     nrf_802154_core_hooks_transmitted(p_frame);
     nrf_802154_notify_transmitted(p_frame, p_ack, power, lqi);
 
@@ -315,6 +528,8 @@ static void transmit_failed_notify(nrf_802154_tx_error_t error)
 {
     const uint8_t * p_frame = mp_tx_data;
 
+    nrf_coex_control_release();
+
     if (nrf_802154_core_hooks_tx_failed(p_frame, error))
     {
         nrf_802154_notify_transmit_failed(p_frame, error);
@@ -331,6 +546,7 @@ static void transmit_failed_notify_and_nesting_allow(nrf_802154_tx_error_t error
     nrf_802154_critical_section_nesting_deny();
 }
 
+#if NRF_802154_ENERGY_DETECTION_ENABLED
 /** Notify MAC layer that energy detection procedure ended. */
 static void energy_detected_notify(uint8_t result)
 {
@@ -340,7 +556,9 @@ static void energy_detected_notify(uint8_t result)
 
     nrf_802154_critical_section_nesting_deny();
 }
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
+#if NRF_802154_CCA_PROCEDURE_ENABLED
 /** Notify MAC layer that CCA procedure ended. */
 static void cca_notify(bool result)
 {
@@ -350,6 +568,17 @@ static void cca_notify(bool result)
 
     nrf_802154_critical_section_nesting_deny();
 }
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
+
+/** Set given CCA configuration in RADIO registers. */
+static void cca_configuration_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
+{
+    nrf_radio_cca_mode_set(p_cca_cfg->mode);
+    nrf_radio_cca_ed_threshold_set(
+            nrf_802154_rssi_cca_ed_threshold_corrected_get(p_cca_cfg->ed_threshold));
+    nrf_radio_cca_corr_threshold_set(p_cca_cfg->corr_threshold);
+    nrf_radio_cca_corr_counter_set(p_cca_cfg->corr_limit);
+}
 
 /** Update CCA configuration in RADIO registers. */
 static void cca_configuration_update(void)
@@ -357,11 +586,7 @@ static void cca_configuration_update(void)
     nrf_802154_cca_cfg_t cca_cfg;
 
     nrf_802154_pib_cca_cfg_get(&cca_cfg);
-    nrf_radio_cca_mode_set(cca_cfg.mode);
-    nrf_radio_cca_ed_threshold_set(
-            nrf_802154_rssi_cca_ed_threshold_corrected_get(cca_cfg.ed_threshold));
-    nrf_radio_cca_corr_threshold_set(cca_cfg.corr_threshold);
-    nrf_radio_cca_corr_counter_set(cca_cfg.corr_limit);
+    cca_configuration_set(&cca_cfg);
 }
 
 /** Check if PSDU is currently being received.
@@ -416,7 +641,7 @@ static bool timeslot_is_granted(void)
  */
 static void rx_buffer_in_use_set(rx_buffer_t * p_rx_buffer)
 {
-#if NRF_802154_RX_BUFFERS > 1
+#if (NRF_802154_RX_BUFFERS != 1) || (RX_BUFFERS_TOTAL > 1) || NRF_802154_MULTI_INSTANCE_ENABLED
     mp_current_rx_buffer = p_rx_buffer;
 #else
     (void) p_rx_buffer;
@@ -442,6 +667,98 @@ static uint8_t * rx_buffer_get(void)
     return rx_buffer_is_available() ? mp_current_rx_buffer->psdu : NULL;
 }
 
+/** Mark given rx buffer as containing a frame that is handed over to the higher layer.
+ *
+ * @param[in]  p_rx_buffer  Pointer to the receive buffer containing the frame.
+ */
+static void rx_buffer_handover(rx_buffer_t * p_rx_buffer)
+{
+    p_rx_buffer->free = false;
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+    // Ownership of a donated buffer returns to the higher layer with the frame.
+    nrf_802154_rx_buffer_donated_release(p_rx_buffer);
+#endif
+}
+
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_DROP_BROADCAST
+/** Check if given received frame is a broadcast frame that can be dropped.
+ *
+ * @param[in]  p_data  Pointer to PSDU of the received frame.
+ *
+ * @retval true   The frame is a broadcast frame.
+ * @retval false  The frame is not a broadcast frame or its destination address was not found.
+ */
+static bool rx_frame_is_broadcast(const uint8_t * p_data)
+{
+    if ((p_data[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT) ||
+        ((p_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2) ||
+        ((p_data[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK) != DEST_ADDR_TYPE_SHORT))
+    {
+        return false;
+    }
+
+    return 0 == memcmp(&p_data[DEST_ADDR_OFFSET], BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE);
+}
+#endif // NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_DROP_BROADCAST
+
+/** Find a free rx buffer applying configured overflow policy if all buffers are in use.
+ *
+ * @returns Pointer to a free rx buffer or NULL if there is no buffer available.
+ */
+static rx_buffer_t * rx_buffer_free_find(void)
+{
+    rx_buffer_t * p_buffer = nrf_802154_rx_buffer_free_find();
+
+    if (p_buffer != NULL)
+    {
+        m_rx_overflow = false;
+        return p_buffer;
+    }
+
+    // Count the overflow once, not on every lookup until a regular buffer is freed.
+    if (!m_rx_overflow)
+    {
+        m_rx_overflow = true;
+        m_rx_overflow_stats.no_buffer++;
+    }
+
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+    p_buffer = nrf_802154_rx_buffer_emergency_find();
+#elif NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_DROP_BROADCAST
+    p_buffer = (rx_buffer_t *)nrf_802154_notify_received_withdraw(rx_frame_is_broadcast);
+
+    if (p_buffer != NULL)
+    {
+        p_buffer->free = true;
+        m_rx_overflow_stats.broadcast_dropped++;
+    }
+#endif
+
+    return p_buffer;
+}
+
+/** Check if frame being received can be stored in currently used rx buffer.
+ *
+ * The emergency buffer accepts only MAC command frames.
+ *
+ * @retval true   The frame can be received.
+ * @retval false  The frame should be dropped.
+ */
+static bool rx_buffer_accepts_frame(void)
+{
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+    if (nrf_802154_rx_buffer_is_emergency(mp_current_rx_buffer) &&
+        ((mp_current_rx_buffer->psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_COMMAND))
+    {
+        m_rx_overflow_stats.emergency_rejected++;
+        return false;
+    }
+#endif
+
+    return true;
+}
+
 /***************************************************************************************************
  * @section Radio parameters calculators
  **************************************************************************************************/
@@ -457,11 +774,78 @@ static void channel_set(uint8_t channel)
     nrf_radio_frequency_set(5 + (5 * (channel - 11)));
 }
 
+/** Restore channel and CCA configuration from PIB if a transmit descriptor changed them. */
+static void tx_desc_params_restore(void)
+{
+#if NRF_802154_TX_EX_ENABLED
+    if (m_tx_desc_applied)
+    {
+        channel_set(nrf_802154_pib_channel_get());
+        cca_configuration_update();
+
+        m_tx_desc_applied = false;
+    }
+#endif // NRF_802154_TX_EX_ENABLED
+}
+
+/** Set transmit power, channel and CCA configuration for a frame to transmit.
+ *
+ *  Parameters not overridden by a transmit descriptor of the frame are taken from PIB. Transmit
+ *  power taken from PIB may be reduced by the automatic transmit power control.
+ *
+ *  @param[in]  p_data  Pointer to the frame to transmit.
+ */
+static void tx_params_set(const uint8_t * p_data)
+{
+    int8_t tx_power       = nrf_802154_pib_tx_power_get();
+    bool   tx_power_fixed = false;
+
+#if NRF_802154_TX_EX_ENABLED
+    const nrf_802154_tx_desc_t * p_desc = nrf_802154_tx_desc_get(p_data);
+
+    tx_desc_params_restore();
+
+    if (p_desc != NULL)
+    {
+        if (p_desc->flags & NRF_802154_TX_DESC_POWER)
+        {
+            tx_power       = p_desc->tx_power;
+            tx_power_fixed = true;
+        }
+
+        if (p_desc->flags & NRF_802154_TX_DESC_CHANNEL)
+        {
+            channel_set(p_desc->channel);
+            m_tx_desc_applied = true;
+        }
+
+        if (p_desc->flags & NRF_802154_TX_DESC_CCA_CFG)
+        {
+            cca_configuration_set(&p_desc->cca_cfg);
+            m_tx_desc_applied = true;
+        }
+    }
+#endif // NRF_802154_TX_EX_ENABLED
+
+#if NRF_802154_TX_POWER_CTRL_ENABLED
+    if (!tx_power_fixed)
+    {
+        tx_power = nrf_802154_tx_power_ctrl_tx_power_get(p_data, tx_power);
+    }
+#endif // NRF_802154_TX_POWER_CTRL_ENABLED
+
+    (void)p_data;
+    (void)tx_power_fixed;
+
+    nrf_radio_tx_power_set(tx_power);
+}
+
 /***************************************************************************************************
  * @section ACK transmission management
  **************************************************************************************************/
 
 /// Set valid sequence number in ACK frame.
+NRF_802154_RAM_CODE
 static void ack_prepare(void)
 {
     // Copy sequence number from received frame to ACK frame.
@@ -469,6 +853,7 @@ static void ack_prepare(void)
 }
 
 /// Set pending bit in ACK frame.
+NRF_802154_RAM_CODE
 static void ack_pending_bit_set(void)
 {
     m_ack_psdu[FRAME_PENDING_OFFSET] = ACK_HEADER_WITH_PENDING;
@@ -561,6 +946,28 @@ static void nrf_radio_reset(void)
     nrf_802154_log(EVENT_RADIO_RESET, 0);
 }
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+/** Stop radio peripheral activity without losing its configuration. */
+static void nrf_radio_light_reset(void)
+{
+    nrf_radio_int_disable(0xFFFFFFFF);
+    nrf_radio_shorts_set(SHORTS_IDLE);
+    nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
+
+    m_radio_cfg_retained = true;
+}
+
+/** Check if radio peripheral still holds configuration applied by @ref nrf_radio_init.
+ *
+ * Other users of the RADIO peripheral may reconfigure it while the driver sleeps. The CRC
+ * polynomial is used as a signature of the IEEE 802.15.4 configuration.
+ */
+static bool nrf_radio_cfg_is_retained(void)
+{
+    return m_radio_cfg_retained && (nrf_radio_crc_polynominal_get() == CRC_POLYNOMIAL);
+}
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 /** Initialize interrupts for radio peripheral. */
 static void irq_init(void)
 {
@@ -602,6 +1009,7 @@ static void nrf_timer_init(void)
  * @section Energy detection management
  **************************************************************************************************/
 
+#if NRF_802154_ENERGY_DETECTION_ENABLED
 /** Get ED result value.
  *
  * @returns ED result based on data collected during Energy Detection procedure.
@@ -665,6 +1073,7 @@ static bool ed_iter_setup(uint32_t time_us)
         return false;
     }
 }
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
 
 /***************************************************************************************************
@@ -758,6 +1167,80 @@ static void ppis_for_egu_and_ramp_up_set(nrf_radio_task_t ramp_up_task, bool sel
     nrf_ppi_channel_enable(PPI_DISABLED_EGU);
 }
 
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+/** Set PPIs to connect HP timer trigger->EGU->RAMP_UP at time set by nrf_802154_core_tx_trigger_set.
+ *
+ * RADIO is disabled immediately, but ramp up is started by the HP timer trigger instead of
+ * the DISABLED event. PPIs are self-disabling.
+ *
+ * @param[in]  ramp_up_task  Task triggered to start ramp up procedure.
+ *
+ * @retval true   Ramp up will be started by the HP timer.
+ * @retval false  Trigger time is not set or cannot be met. Ramp up shall be started immediately.
+ */
+static bool ppis_for_hp_timer_and_ramp_up_set(nrf_radio_task_t ramp_up_task)
+{
+    uint32_t trigger_time;
+
+    if (!m_tx_trigger_is_set)
+    {
+        return false;
+    }
+
+    m_tx_trigger_is_set = false;
+
+    if (!nrf_802154_timer_coord_hp_time_get(m_tx_trigger_time, &trigger_time))
+    {
+        return false;
+    }
+
+    nrf_ppi_channel_disable(PPI_DISABLED_EGU);
+
+    nrf_ppi_channel_and_fork_endpoint_setup(PPI_EGU_RAMP_UP,
+                                            (uint32_t)nrf_egu_event_address_get(
+                                                    NRF_802154_SWI_EGU_INSTANCE,
+                                                    EGU_EVENT),
+                                            (uint32_t)nrf_radio_task_address_get(ramp_up_task),
+                                            (uint32_t)nrf_ppi_task_address_get(
+                                                    PPI_CHGRP0_DIS_TASK));
+
+    // DISABLED event is connected again by the procedures following the transmission.
+    nrf_ppi_channel_endpoint_setup(PPI_DISABLED_EGU,
+                                   (uint32_t)nrf_radio_event_address_get(NRF_RADIO_EVENT_DISABLED),
+                                   (uint32_t)nrf_egu_task_address_get(
+                                           NRF_802154_SWI_EGU_INSTANCE,
+                                           EGU_TASK));
+
+    nrf_ppi_channel_endpoint_setup(PPI_HP_TIMER_EGU,
+                                   nrf_802154_hp_timer_trigger_event_get(),
+                                   (uint32_t)nrf_egu_task_address_get(
+                                           NRF_802154_SWI_EGU_INSTANCE,
+                                           EGU_TASK));
+
+    nrf_ppi_channel_include_in_group(PPI_EGU_RAMP_UP, PPI_CHGRP0);
+    nrf_ppi_channel_include_in_group(PPI_HP_TIMER_EGU, PPI_CHGRP0);
+
+    nrf_ppi_channel_enable(PPI_EGU_RAMP_UP);
+
+    nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
+
+    nrf_802154_hp_timer_trigger_set(trigger_time);
+    nrf_ppi_channel_enable(PPI_HP_TIMER_EGU);
+
+    if ((int32_t)(trigger_time - nrf_802154_hp_timer_current_time_get()) < TX_TRIGGER_MARGIN)
+    {
+        // Too late to rely on the trigger. If it fired anyway, the immediate ramp up procedure
+        // detects that RADIO is already ramping up.
+        nrf_ppi_channel_disable(PPI_HP_TIMER_EGU);
+        nrf_ppi_channel_remove_from_group(PPI_HP_TIMER_EGU, PPI_CHGRP0);
+
+        return false;
+    }
+
+    return true;
+}
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+
 /** Configure FEM to set LNA at appropriate time. */
 static void fem_for_lna_set(nrf_timer_cc_channel_t cc_channel,
                             nrf_timer_short_mask_t short_mask)
@@ -856,6 +1339,82 @@ static void fem_for_tx_reset(bool disable_ppi_egu_timer_start)
     }
 }
 
+/** Configure coexistence arbitration for TX procedure.
+ *
+ * REQUEST is raised when EGU starts the TIMER. The radio ramps up on a TIMER compare after
+ * the request-to-grant time. FEM pins configured by @ref fem_for_tx_set are delayed accordingly.
+ *
+ * @param[in]  ramp_up_task  Task triggered to start ramp up procedure.
+ * @param[in]  cca           If CCA is performed before transmission.
+ *
+ * @retval true   PPIs are set to ramp up on the TIMER compare.
+ * @retval false  Arbitration is disabled. Ramp up shall be started by EGU.
+ */
+static bool coex_for_tx_set(nrf_radio_task_t ramp_up_task, bool cca)
+{
+    uint32_t               delay  = nrf_coex_control_tx_delay_get();
+    nrf_timer_cc_channel_t fem_cc = cca ? NRF_TIMER_CC_CHANNEL0 : NRF_TIMER_CC_CHANNEL1;
+
+    if (delay == 0)
+    {
+        return false;
+    }
+
+    // Anomaly 78: use SHUTDOWN instead of STOP and CLEAR.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+    nrf_timer_event_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE3);
+    nrf_timer_cc_write(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL3, delay);
+    nrf_timer_cc_write(NRF_802154_TIMER_INSTANCE,
+                       fem_cc,
+                       nrf_timer_cc_read(NRF_802154_TIMER_INSTANCE, fem_cc) + delay);
+
+    nrf_ppi_channel_endpoint_setup(PPI_EGU_TIMER_START,
+                                   (uint32_t)nrf_egu_event_address_get(
+                                           NRF_802154_SWI_EGU_INSTANCE,
+                                           EGU_EVENT),
+                                   (uint32_t)nrf_timer_task_address_get(
+                                           NRF_802154_TIMER_INSTANCE,
+                                           NRF_TIMER_TASK_START));
+    nrf_coex_control_tx_request_ppi_setup(PPI_EGU_TIMER_START);
+
+    nrf_ppi_channel_and_fork_endpoint_setup(PPI_EGU_RAMP_UP,
+                                            (uint32_t)nrf_timer_event_address_get(
+                                                    NRF_802154_TIMER_INSTANCE,
+                                                    NRF_TIMER_EVENT_COMPARE3),
+                                            (uint32_t)nrf_radio_task_address_get(ramp_up_task),
+                                            (uint32_t)nrf_ppi_task_address_get(
+                                                    PPI_CHGRP0_DIS_TASK));
+
+    nrf_ppi_channel_endpoint_setup(PPI_DISABLED_EGU,
+                                   (uint32_t)nrf_radio_event_address_get(NRF_RADIO_EVENT_DISABLED),
+                                   (uint32_t)nrf_egu_task_address_get(
+                                           NRF_802154_SWI_EGU_INSTANCE,
+                                           EGU_TASK));
+
+    nrf_ppi_channel_include_in_group(PPI_EGU_RAMP_UP, PPI_CHGRP0);
+
+    nrf_ppi_channel_enable(PPI_EGU_TIMER_START);
+    nrf_ppi_channel_enable(PPI_EGU_RAMP_UP);
+    nrf_ppi_channel_enable(PPI_DISABLED_EGU);
+
+    return true;
+}
+
+/** Reset coexistence arbitration configuration for TX procedure. */
+static void coex_for_tx_reset(void)
+{
+    if (nrf_coex_control_tx_delay_get() == 0)
+    {
+        return;
+    }
+
+    nrf_ppi_channel_disable(PPI_EGU_TIMER_START);
+    nrf_ppi_fork_endpoint_setup(PPI_EGU_TIMER_START, 0);
+
+    // Anomaly 78: use SHUTDOWN instead of STOP and CLEAR.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+}
+
 /** Restart RX procedure after frame was received (and no ACK transmitted). */
 static void rx_restart(bool set_shorts)
 {
@@ -1003,6 +1562,7 @@ static void tx_ack_terminate(void)
 #endif // NRF_802154_DISABLE_BCC_MATCHING
 
     nrf_fem_control_ppi_disable(NRF_FEM_CONTROL_PA_PIN);
+    nrf_coex_control_release();
 
     nrf_ppi_channel_remove_from_group(PPI_EGU_RAMP_UP, PPI_CHGRP0);
 #if !NRF_802154_DISABLE_BCC_MATCHING
@@ -1040,17 +1600,28 @@ static void tx_terminate(void)
 
     nrf_ppi_channel_disable(PPI_DISABLED_EGU);
     nrf_ppi_channel_disable(PPI_EGU_RAMP_UP);
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+    nrf_ppi_channel_disable(PPI_HP_TIMER_EGU);
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
 
     fem_for_tx_reset(true);
+    coex_for_tx_reset();
+    nrf_coex_control_release();
 
     nrf_ppi_channel_remove_from_group(PPI_EGU_RAMP_UP, PPI_CHGRP0);
     nrf_ppi_fork_endpoint_setup(PPI_EGU_RAMP_UP, 0);
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+    nrf_ppi_channel_remove_from_group(PPI_HP_TIMER_EGU, PPI_CHGRP0);
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
 
     if (timeslot_is_granted())
     {
         ints_to_disable = nrf_802154_revision_has_phyend_event() ?
                 NRF_RADIO_INT_PHYEND_MASK : NRF_RADIO_INT_END_MASK;
         ints_to_disable |= NRF_RADIO_INT_CCABUSY_MASK;
+#if NRF_802154_COEX_ENABLED
+        ints_to_disable |= NRF_RADIO_INT_CCAIDLE_MASK;
+#endif // NRF_802154_COEX_ENABLED
 #if NRF_802154_TX_STARTED_NOTIFY_ENABLED
         ints_to_disable |= NRF_RADIO_INT_ADDRESS_MASK;
 #endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
@@ -1083,6 +1654,7 @@ static void rx_ack_terminate(void)
     }
 }
 
+#if NRF_802154_ENERGY_DETECTION_ENABLED
 /** Terminate ED procedure. */
 static void ed_terminate(void)
 {
@@ -1102,7 +1674,9 @@ static void ed_terminate(void)
         nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
     }
 }
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
+#if NRF_802154_CCA_PROCEDURE_ENABLED
 /** Terminate CCA procedure. */
 static void cca_terminate(void)
 {
@@ -1122,7 +1696,9 @@ static void cca_terminate(void)
         nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
     }
 }
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 
+#if NRF_802154_CONTINUOUS_CARRIER_ENABLED
 /** Terminate Continuous Carrier procedure. */
 static void continuous_carrier_terminate(void)
 {
@@ -1136,6 +1712,7 @@ static void continuous_carrier_terminate(void)
         nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
     }
 }
+#endif // NRF_802154_CONTINUOUS_CARRIER_ENABLED
 
 /** Terminate ongoing operation.
  *
@@ -1184,7 +1761,7 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
 
                         if (notify)
                         {
-                            nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_ABORTED);
+                            receive_failed_notify(NRF_802154_RX_ERROR_ABORTED);
                         }
                     }
                     else
@@ -1206,7 +1783,7 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
 
                     if (notify)
                     {
-                        mp_current_rx_buffer->free = false;
+                        rx_buffer_handover(mp_current_rx_buffer);
                         received_frame_notify(mp_current_rx_buffer->psdu);
                     }
                 }
@@ -1252,6 +1829,7 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
 
                 break;
 
+#if NRF_802154_ENERGY_DETECTION_ENABLED
             case RADIO_STATE_ED:
                 if (term_lvl >= NRF_802154_TERM_802154)
                 {
@@ -1268,7 +1846,9 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
                 }
 
                 break;
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
+#if NRF_802154_CCA_PROCEDURE_ENABLED
             case RADIO_STATE_CCA:
                 if (term_lvl >= NRF_802154_TERM_802154)
                 {
@@ -1284,10 +1864,13 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
                     result = false;
                 }
                 break;
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 
+#if NRF_802154_CONTINUOUS_CARRIER_ENABLED
             case RADIO_STATE_CONTINUOUS_CARRIER:
                 continuous_carrier_terminate();
                 break;
+#endif // NRF_802154_CONTINUOUS_CARRIER_ENABLED
 
             default:
                 assert(false);
@@ -1303,6 +1886,7 @@ static void sleep_init(void)
     nrf_802154_priority_drop_timeslot_exit();
     m_rsch_timeslot_is_granted = false;
     nrf_802154_timer_coord_stop();
+    nrf_fem_control_power_down();
 }
 
 /** Initialize Falling Asleep operation. */
@@ -1340,6 +1924,8 @@ static void rx_init(bool disabled_was_triggered)
         return;
     }
 
+    tx_desc_params_restore();
+
     // Clear filtering flag
     rx_flags_clear();
 
@@ -1374,6 +1960,11 @@ static void rx_init(bool disabled_was_triggered)
     ints_to_enable |= NRF_RADIO_INT_CRCOK_MASK;
     nrf_radio_int_enable(ints_to_enable);
 
+#if NRF_802154_ANT_DIV_ENABLED
+    // Select antenna
+    nrf_802154_ant_div_ctrl_rx_prepare();
+#endif // NRF_802154_ANT_DIV_ENABLED
+
     // Set FEM
     nrf_fem_control_ppi_enable(NRF_FEM_CONTROL_LNA_PIN, NRF_TIMER_CC_CHANNEL0);
     lna_target_time = nrf_fem_control_delay_get(NRF_FEM_CONTROL_LNA_PIN);
@@ -1486,7 +2077,7 @@ static void rx_init(bool disabled_was_triggered)
     // Find RX buffer if none available
     if (!free_buffer)
     {
-        rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+        rx_buffer_in_use_set(rx_buffer_free_find());
 
         if (rx_buffer_is_available())
         {
@@ -1512,7 +2103,7 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
         return false;
     }
 
-    nrf_radio_tx_power_set(nrf_802154_pib_tx_power_get());
+    tx_params_set(p_data);
     nrf_radio_packet_ptr_set(p_data);
 
     // Set shorts
@@ -1534,6 +2125,15 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
     {
         nrf_radio_event_clear(NRF_RADIO_EVENT_CCABUSY);
         ints_to_enable |= NRF_RADIO_INT_CCABUSY_MASK;
+
+#if NRF_802154_COEX_ENABLED
+        if (nrf_coex_control_tx_delay_get() != 0)
+        {
+            // GRANT is sampled when CCA reports idle channel and the transmitter ramps up.
+            nrf_radio_event_clear(NRF_RADIO_EVENT_CCAIDLE);
+            ints_to_enable |= NRF_RADIO_INT_CCAIDLE_MASK;
+        }
+#endif // NRF_802154_COEX_ENABLED
     }
 
     nrf_radio_event_clear(NRF_RADIO_EVENT_ADDRESS);
@@ -1544,14 +2144,29 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
 
     nrf_radio_int_enable(ints_to_enable);
 
+#if NRF_802154_ANT_DIV_ENABLED
+    // Select antenna
+    nrf_802154_ant_div_ctrl_tx_prepare(p_data);
+#endif // NRF_802154_ANT_DIV_ENABLED
+
     // Set FEM
     fem_for_tx_set(cca);
 
     // Clr event EGU
     nrf_egu_event_clear(NRF_802154_SWI_EGU_INSTANCE, EGU_EVENT);
 
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+    if (ppis_for_hp_timer_and_ramp_up_set(cca ? NRF_RADIO_TASK_RXEN : NRF_RADIO_TASK_TXEN))
+    {
+        return true;
+    }
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+
     // Set PPIs
-    ppis_for_egu_and_ramp_up_set(cca ? NRF_RADIO_TASK_RXEN : NRF_RADIO_TASK_TXEN, true);
+    if (!coex_for_tx_set(cca ? NRF_RADIO_TASK_RXEN : NRF_RADIO_TASK_TXEN, cca))
+    {
+        ppis_for_egu_and_ramp_up_set(cca ? NRF_RADIO_TASK_RXEN : NRF_RADIO_TASK_TXEN, true);
+    }
 
     if (!disabled_was_triggered || !ppi_egu_worked())
     {
@@ -1561,6 +2176,7 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
     return true;
 }
 
+#if NRF_802154_ENERGY_DETECTION_ENABLED
 /** Initialize ED operation */
 static void ed_init(bool disabled_was_triggered)
 {
@@ -1570,6 +2186,8 @@ static void ed_init(bool disabled_was_triggered)
         return;
     }
 
+    tx_desc_params_restore();
+
     // Set shorts
     nrf_radio_shorts_set(SHORTS_ED);
 
@@ -1591,7 +2209,9 @@ static void ed_init(bool disabled_was_triggered)
         nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
     }
 }
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
+#if NRF_802154_CCA_PROCEDURE_ENABLED
 /** Initialize CCA operation. */
 static void cca_init(bool disabled_was_triggered)
 {
@@ -1600,6 +2220,8 @@ static void cca_init(bool disabled_was_triggered)
         return;
     }
 
+    tx_desc_params_restore();
+
     // Set shorts
     nrf_radio_shorts_set(SHORTS_CCA);
 
@@ -1622,7 +2244,9 @@ static void cca_init(bool disabled_was_triggered)
         nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
     }
 }
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 
+#if NRF_802154_CONTINUOUS_CARRIER_ENABLED
 /** Initialize Continuous Carrier operation. */
 static void continuous_carrier_init(bool disabled_was_triggered)
 {
@@ -1631,6 +2255,8 @@ static void continuous_carrier_init(bool disabled_was_triggered)
         return;
     }
 
+    tx_desc_params_restore();
+
     // Set FEM
     fem_for_pa_set();
 
@@ -1645,8 +2271,97 @@ static void continuous_carrier_init(bool disabled_was_triggered)
         nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
     }
 }
+#endif // NRF_802154_CONTINUOUS_CARRIER_ENABLED
+
+
+/** Enter the idle state that follows the end of the transmission procedure.
+ *
+ * The receiver is enabled. If @ref NRF_802154_RX_WINDOW_AFTER_TX_ENABLED is set, the radio falls
+ * asleep instead if the receiver should be disabled when idle and no receive window after
+ * transmission is configured.
+ */
+static void idle_after_tx_init(void)
+{
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+    if (!nrf_802154_pib_rx_on_when_idle_get() && (nrf_802154_pib_rx_window_after_tx_get() == 0))
+    {
+        state_set(RADIO_STATE_FALLING_ASLEEP);
+        falling_asleep_init();
+        return;
+    }
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
+    state_set(RADIO_STATE_RX);
+    rx_init(true);
+}
+
+/** Check if the coexistence arbiter grants the medium when the radio ramps up for a frame.
+ *
+ *  This function shall be called after @ref tx_init started the procedure. It waits for
+ *  the TIMER compare that triggers the ramp-up, which follows the request-to-grant time.
+ *  The wait is bounded in case the TIMER was not started. If CCA is performed, GRANT is
+ *  sampled later by the CCAIDLE handler, when the transmitter ramps up.
+ *
+ *  @param[in]  cca  If CCA is performed before transmission.
+ *
+ *  @retval true   The frame may be transmitted.
+ *  @retval false  The medium is denied by the arbiter.
+ */
+static bool tx_coex_grant_check(bool cca)
+{
+    uint32_t delay = nrf_coex_control_tx_delay_get();
+    uint32_t t0;
+
+    if ((delay == 0) || cca)
+    {
+        return true;
+    }
+
+    t0 = nrf_802154_timer_sched_time_get();
+
+    while (!nrf_timer_event_check(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE3))
+    {
+        if (!nrf_802154_timer_sched_time_is_in_future(nrf_802154_timer_sched_time_get(),
+                                                      t0,
+                                                      delay + COEX_GRANT_WAIT_MARGIN))
+        {
+            return false;
+        }
+    }
+
+    return nrf_coex_control_tx_grant_check();
+}
 
+/** Terminate the transmission of a frame for which the medium is denied by the arbiter. */
+static void tx_coex_denied(void)
+{
+    tx_terminate();
+    idle_after_tx_init();
+    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_COEX_DENIED);
+}
+
+/** Initialize TX operation that waited for a timeslot.
+ *
+ *  The frame is dropped if its transmission cannot end before the deadline of the frame.
+ *
+ *  @param[in]  cca  If CCA should be performed before transmission.
+ */
+static void tx_resume(bool cca)
+{
+#if NRF_802154_TX_EX_ENABLED
+    if (!nrf_802154_tx_desc_deadline_is_met(mp_tx_data, nrf_802154_timer_sched_time_get(), cca))
+    {
+        idle_after_tx_init();
+        transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_DEADLINE);
+        return;
+    }
+#endif // NRF_802154_TX_EX_ENABLED
 
+    if (tx_init(mp_tx_data, cca, false) && !tx_coex_grant_check(cca))
+    {
+        tx_coex_denied();
+    }
+}
 
 /***************************************************************************************************
  * @section Radio Scheduler notification handlers
@@ -1658,8 +2373,24 @@ void nrf_802154_critical_section_rsch_prec_approved(void)
 
     if (remaining_timeslot_time_is_enough_for_crit_sect())
     {
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+        if (nrf_radio_cfg_is_retained())
+        {
+            // Channel and CCA configuration may have been changed in PIB during sleep.
+            cca_configuration_update();
+            channel_set(nrf_802154_pib_channel_get());
+        }
+        else
+        {
+            nrf_radio_reset();
+            nrf_radio_init();
+        }
+
+        m_radio_cfg_retained = false;
+#else // NRF_802154_LIGHT_SLEEP_ENABLED
         nrf_radio_reset();
         nrf_radio_init();
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
         irq_init();
 
         assert(nrf_radio_shorts_get() == SHORTS_IDLE);
@@ -1668,6 +2399,7 @@ void nrf_802154_critical_section_rsch_prec_approved(void)
         {
             m_rsch_timeslot_is_granted = true;
             nrf_802154_timer_coord_start();
+            nrf_fem_control_power_up();
         }
 
         switch (m_state)
@@ -1682,24 +2414,30 @@ void nrf_802154_critical_section_rsch_prec_approved(void)
                 break;
 
             case RADIO_STATE_CCA_TX:
-                (void)tx_init(mp_tx_data, true, false);
+                tx_resume(true);
                 break;
 
             case RADIO_STATE_TX:
-                (void)tx_init(mp_tx_data, false, false);
+                tx_resume(false);
                 break;
 
+#if NRF_802154_ENERGY_DETECTION_ENABLED
             case RADIO_STATE_ED:
                 ed_init(false);
                 break;
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
+#if NRF_802154_CCA_PROCEDURE_ENABLED
             case RADIO_STATE_CCA:
                 cca_init(false);
                 break;
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 
+#if NRF_802154_CONTINUOUS_CARRIER_ENABLED
             case RADIO_STATE_CONTINUOUS_CARRIER:
                 continuous_carrier_init(false);
                 break;
+#endif // NRF_802154_CONTINUOUS_CARRIER_ENABLED
 
             default:
                 assert(false);
@@ -1716,8 +2454,21 @@ void nrf_802154_critical_section_rsch_prec_denied(void)
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TIMESLOT_ENDED);
 
     irq_deinit();
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+    if (m_state == RADIO_STATE_SLEEP)
+    {
+        nrf_radio_light_reset();
+    }
+    else
+    {
+        nrf_radio_reset();
+    }
+#else // NRF_802154_LIGHT_SLEEP_ENABLED
     nrf_radio_reset();
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
     nrf_fem_control_pin_clear();
+    nrf_fem_control_power_down();
+    nrf_coex_control_release();
 
     m_rsch_timeslot_is_granted = false;
     nrf_802154_timer_coord_stop();
@@ -1741,14 +2492,14 @@ void nrf_802154_critical_section_rsch_prec_denied(void)
         case RADIO_STATE_RX:
             if (psdu_is_being_received())
             {
-                receive_failed_notify(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
+                receive_failed_notify_and_nesting_allow(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
             }
 
             break;
 
         case RADIO_STATE_TX_ACK:
             state_set(RADIO_STATE_RX);
-            mp_current_rx_buffer->free = false;
+            rx_buffer_handover(mp_current_rx_buffer);
             received_frame_notify_and_nesting_allow(mp_current_rx_buffer->psdu);
             break;
 
@@ -1777,6 +2528,7 @@ void nrf_802154_critical_section_rsch_prec_denied(void)
  * @section RADIO interrupt handler
  **************************************************************************************************/
 
+NRF_802154_RAM_CODE
 static void irq_address_state_tx_frame(void)
 {
     transmit_started_notify();
@@ -1786,6 +2538,7 @@ static void irq_address_state_tx_frame(void)
 #endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
 }
 
+NRF_802154_RAM_CODE
 static void irq_address_state_tx_ack(void)
 {
     nrf_802154_tx_ack_started();
@@ -1794,6 +2547,7 @@ static void irq_address_state_tx_ack(void)
 #if !NRF_802154_DISABLE_BCC_MATCHING
 // This event is generated during frame reception to request Radio Scheduler timeslot
 // and to filter frame
+NRF_802154_RAM_CODE
 static void irq_bcmatch_state_rx(void)
 {
     uint8_t               prev_num_psdu_bytes;
@@ -1813,6 +2567,16 @@ static void irq_bcmatch_state_rx(void)
         return;
     }
 
+    if (!m_flags.frame_filtered && !rx_buffer_accepts_frame())
+    {
+        // Only the emergency buffer is available and the frame is not a MAC command.
+        rx_terminate();
+        rx_buffer_in_use_set(rx_buffer_free_find());
+        rx_init(true);
+
+        return;
+    }
+
     if (!m_flags.frame_filtered)
     {
         m_flags.psdu_being_received = true;
@@ -1840,7 +2604,7 @@ static void irq_bcmatch_state_rx(void)
             if ((mp_current_rx_buffer->psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) !=
                 FRAME_TYPE_ACK)
             {
-                receive_failed_notify(filter_result);
+                receive_failed_notify_and_nesting_allow(filter_result);
             }
         }
         else
@@ -1862,24 +2626,26 @@ static void irq_bcmatch_state_rx(void)
             // Disable receiver and wait for a new timeslot.
             rx_terminate();
 
-            nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
+            receive_failed_notify(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
         }
     }
 }
 #endif //!NRF_802154_DISABLE_BCC_MATCHING
 
 #if !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
+NRF_802154_COLD
 static void irq_crcerror_state_rx(void)
 {
 #if !NRF_802154_DISABLE_BCC_MATCHING
     rx_restart(false);
 #endif //!NRF_802154_DISABLE_BCC_MATCHING
 #if NRF_802154_NOTIFY_CRCERROR
-    receive_failed_notify(NRF_802154_RX_ERROR_INVALID_FCS);
+    receive_failed_notify_and_nesting_allow(NRF_802154_RX_ERROR_INVALID_FCS);
 #endif //NRF_802154_NOTIFY_CRCERROR
 }
 #endif //!NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
 
+NRF_802154_RAM_CODE
 static void irq_crcok_state_rx(void)
 {
     uint8_t * p_received_psdu = mp_current_rx_buffer->psdu;
@@ -1911,6 +2677,12 @@ static void irq_crcok_state_rx(void)
         }
     }
 
+    if (m_flags.frame_filtered && !rx_buffer_accepts_frame())
+    {
+        // Only the emergency buffer is available and the frame is not a MAC command.
+        m_flags.frame_filtered = false;
+    }
+
     // Timeslot request
     if (m_flags.frame_filtered &&
         ack_is_requested(p_received_psdu) &&
@@ -1926,7 +2698,7 @@ static void irq_crcok_state_rx(void)
         if (((p_received_psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
             nrf_802154_pib_promiscuous_get())
         {
-            mp_current_rx_buffer->free = false;
+            rx_buffer_handover(mp_current_rx_buffer);
             received_frame_notify_and_nesting_allow(p_received_psdu);
         }
 
@@ -1936,6 +2708,8 @@ static void irq_crcok_state_rx(void)
 
     if (m_flags.frame_filtered || nrf_802154_pib_promiscuous_get())
     {
+        rx_frame_accepted(p_received_psdu);
+
         if (m_flags.frame_filtered &&
             ack_is_requested(mp_current_rx_buffer->psdu) &&
             nrf_802154_pib_auto_ack_get())
@@ -2003,6 +2777,7 @@ static void irq_crcok_state_rx(void)
             if (wait_for_phyend)
             {
                 ack_pending_bit_set();
+                nrf_coex_control_ack_request();
                 state_set(RADIO_STATE_TX_ACK);
 
                 // Set event handlers
@@ -2035,7 +2810,7 @@ static void irq_crcok_state_rx(void)
             }
             else
             {
-                mp_current_rx_buffer->free = false;
+                rx_buffer_handover(mp_current_rx_buffer);
 
 #if !NRF_802154_DISABLE_BCC_MATCHING
                 nrf_ppi_channel_disable(PPI_TIMER_TX_ACK);
@@ -2052,13 +2827,18 @@ static void irq_crcok_state_rx(void)
         {
             rx_restart(true);
 
+#if NRF_802154_ANT_DIV_ENABLED
+            // Receiver is listening, but no frame is being received yet.
+            nrf_802154_ant_div_ctrl_rx_prepare();
+#endif // NRF_802154_ANT_DIV_ENABLED
+
             // Filter out received ACK frame if promiscuous mode is disabled.
             if (((p_received_psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
                 nrf_802154_pib_promiscuous_get())
             {
                 // Find new RX buffer
-                mp_current_rx_buffer->free = false;
-                rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+                rx_buffer_handover(mp_current_rx_buffer);
+                rx_buffer_in_use_set(rx_buffer_free_find());
 
                 if (rx_buffer_is_available())
                 {
@@ -2095,14 +2875,15 @@ static void irq_crcok_state_rx(void)
 #if NRF_802154_DISABLE_BCC_MATCHING
         if ((p_received_psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK)
         {
-            receive_failed_notify(filter_result);
+            receive_failed_notify_and_nesting_allow(filter_result);
         }
 #else // NRF_802154_DISABLE_BCC_MATCHING
-        receive_failed_notify(NRF_802154_RX_ERROR_RUNTIME);
+        receive_failed_notify_and_nesting_allow(NRF_802154_RX_ERROR_RUNTIME);
 #endif // NRF_802154_DISABLE_BCC_MATCHING
     }
 }
 
+NRF_802154_RAM_CODE
 static void irq_phyend_state_tx_ack(void)
 {
     uint8_t * p_received_psdu = mp_current_rx_buffer->psdu;
@@ -2116,6 +2897,14 @@ static void irq_phyend_state_tx_ack(void)
     nrf_fem_control_ppi_disable(NRF_FEM_CONTROL_PA_PIN);
     nrf_fem_control_ppi_enable(NRF_FEM_CONTROL_LNA_PIN, NRF_TIMER_CC_CHANNEL0);
 
+    // Lines were released by PPI when the radio was disabled after the ACK frame.
+    nrf_coex_control_release();
+
+#if NRF_802154_ANT_DIV_ENABLED
+    // ACK frame was transmitted with the antenna that received the frame. Select the next one.
+    nrf_802154_ant_div_ctrl_rx_prepare();
+#endif // NRF_802154_ANT_DIV_ENABLED
+
     nrf_radio_shorts_set(SHORTS_RX);
 
     // Set BCC for next reception
@@ -2192,8 +2981,8 @@ static void irq_phyend_state_tx_ack(void)
     }
 
     // Find new RX buffer
-    mp_current_rx_buffer->free = false;
-    rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+    rx_buffer_handover(mp_current_rx_buffer);
+    rx_buffer_in_use_set(rx_buffer_free_find());
 
     if (rx_buffer_is_available())
     {
@@ -2213,6 +3002,7 @@ static void irq_phyend_state_tx_ack(void)
     received_frame_notify_and_nesting_allow(p_received_psdu);
 }
 
+NRF_802154_RAM_CODE
 static void irq_phyend_state_tx_frame(void)
 {
     uint32_t ints_to_disable = 0;
@@ -2253,8 +3043,9 @@ static void irq_phyend_state_tx_frame(void)
             nrf_radio_int_enable(NRF_RADIO_INT_END_MASK);
         }
 
-        // Clear FEM configuration set at the beginning of the transmission
+        // Clear FEM and coexistence configuration set at the beginning of the transmission
         fem_for_tx_reset(false);
+        coex_for_tx_reset();
         // Set PPIs necessary in rx_ack state
         fem_for_lna_set(NRF_TIMER_CC_CHANNEL2, NRF_TIMER_SHORT_COMPARE2_STOP_MASK);
 
@@ -2284,7 +3075,7 @@ static void irq_phyend_state_tx_frame(void)
 
         if (!rx_buffer_free)
         {
-            rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
+            rx_buffer_in_use_set(rx_buffer_free_find());
 
             if (rx_buffer_is_available())
             {
@@ -2303,27 +3094,134 @@ static void irq_phyend_state_tx_frame(void)
     else
     {
         tx_terminate();
-        state_set(RADIO_STATE_RX);
-        rx_init(true);
+        idle_after_tx_init();
 
         transmitted_frame_notify(NULL, 0, 0);
     }
 }
 
+#if NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+/** Check if frame received instead of the expected ACK should be passed to the MAC layer.
+ *
+ * ACK frames are never passed, because they are either mismatched or ACKs of other nodes.
+ * ACK transmission is not possible for frames received in this state, because the TIMER is not
+ * synchronized with the end of the received frame. Such frames are notified without ACK and
+ * the originator is expected to retransmit them.
+ *
+ * @param[in]  p_psdu  Pointer to PSDU of the received frame.
+ *
+ * @retval  true   Frame has valid CRC, passed filtering and should be notified.
+ * @retval  false  Frame should be dropped.
+ */
+static bool rx_ack_frame_is_kept(const uint8_t * p_psdu)
+{
+    uint8_t num_psdu_bytes      = PHR_SIZE + FCF_SIZE;
+    uint8_t prev_num_psdu_bytes = 0;
+
+    if ((nrf_radio_crc_status_get() != NRF_RADIO_CRC_STATUS_OK) ||
+        ((p_psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) == FRAME_TYPE_ACK))
+    {
+        return false;
+    }
+
+    if (nrf_802154_pib_promiscuous_get())
+    {
+        return true;
+    }
+
+    while (num_psdu_bytes != prev_num_psdu_bytes)
+    {
+        prev_num_psdu_bytes = num_psdu_bytes;
+
+        // Keep checking consecutive parts of the frame header.
+        if (nrf_802154_filter_frame_part(p_psdu, &num_psdu_bytes) != NRF_802154_RX_ERROR_NONE)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/** Restart receiver to keep waiting for ACK after another frame was received.
+ *
+ * @retval  true   Receiver is restarted with a new RX buffer.
+ * @retval  false  There is no free RX buffer to receive ACK.
+ */
+static bool rx_ack_restart(void)
+{
+    rx_buffer_in_use_set(rx_buffer_free_find());
+
+    if (!rx_buffer_is_available())
+    {
+        return false;
+    }
+
+    // Disable PPIs on DISABLED event to control TIMER.
+    nrf_ppi_channel_disable(PPI_DISABLED_EGU);
+
+    nrf_radio_packet_ptr_set(rx_buffer_get());
+    nrf_radio_shorts_set(SHORTS_RX_ACK | SHORTS_RX_FREE_BUFFER);
+    nrf_radio_event_clear(NRF_RADIO_EVENT_MHRMATCH);
+
+    // Restart TIMER used to control LNA.
+    // Anomaly 78: use SHUTDOWN instead of STOP and CLEAR.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+
+    // Enable self-disabled PPI
+    nrf_ppi_channel_enable(PPI_EGU_RAMP_UP);
+
+    // Enable PPIs on DISABLED event and clear event to detect if PPI worked
+    nrf_egu_event_clear(NRF_802154_SWI_EGU_INSTANCE, EGU_EVENT);
+    nrf_ppi_channel_enable(PPI_DISABLED_EGU);
+
+    if (!ppi_egu_worked())
+    {
+        nrf_radio_task_trigger(NRF_RADIO_TASK_DISABLE);
+    }
+
+    return true;
+}
+#endif // NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+
+NRF_802154_RAM_CODE
 static void irq_end_state_rx_ack(void)
 {
     bool          ack_match    = ack_is_matched();
     rx_buffer_t * p_ack_buffer = NULL;
+#if NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+    uint8_t     * p_received_psdu = mp_current_rx_buffer->psdu;
+    bool          frame_kept      = false;
+
+    if (!ack_match && rx_ack_frame_is_kept(p_received_psdu))
+    {
+        rx_buffer_handover(mp_current_rx_buffer);
+        frame_kept = true;
+
+        // Keep waiting for ACK until ACK timeout or the higher layer terminates this operation.
+        if (rx_ack_restart())
+        {
+            received_frame_notify_and_nesting_allow(p_received_psdu);
+            return;
+        }
+    }
+#endif // NRF_802154_RX_DURING_ACK_WAIT_ENABLED
 
     if (ack_match)
     {
         p_ack_buffer = mp_current_rx_buffer;
-        mp_current_rx_buffer->free = false;
+        rx_buffer_handover(mp_current_rx_buffer);
     }
 
     rx_ack_terminate();
-    state_set(RADIO_STATE_RX);
-    rx_init(true);
+    idle_after_tx_init();
+
+#if NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+    if (frame_kept)
+    {
+        received_frame_notify_and_nesting_allow(p_received_psdu);
+    }
+#endif // NRF_802154_RX_DURING_ACK_WAIT_ENABLED
 
     if (ack_match)
     {
@@ -2344,6 +3242,7 @@ static void irq_disabled_state_falling_asleep(void)
     sleep_init();
 }
 
+#if NRF_802154_CCA_PROCEDURE_ENABLED
 /// This event is generated when CCA reports idle channel during stand-alone procedure.
 static void irq_ccaidle_state_cca(void)
 {
@@ -2353,16 +3252,32 @@ static void irq_ccaidle_state_cca(void)
 
     cca_notify(true);
 }
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 
+NRF_802154_COLD
 static void irq_ccabusy_state_tx_frame(void)
 {
     tx_terminate();
-    state_set(RADIO_STATE_RX);
-    rx_init(true);
+    idle_after_tx_init();
 
     transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_BUSY_CHANNEL);
 }
 
+#if NRF_802154_COEX_ENABLED
+/// This event is generated when CCA reports idle channel and the transmitter starts ramping up.
+static void irq_ccaidle_state_tx_frame(void)
+{
+    nrf_radio_int_disable(NRF_RADIO_INT_CCAIDLE_MASK);
+
+    if (!nrf_coex_control_tx_grant_check())
+    {
+        // Transmitter is still ramping up, so it is disabled before the frame is transmitted.
+        tx_coex_denied();
+    }
+}
+#endif // NRF_802154_COEX_ENABLED
+
+#if NRF_802154_CCA_PROCEDURE_ENABLED
 static void irq_ccabusy_state_cca(void)
 {
     cca_terminate();
@@ -2371,7 +3286,9 @@ static void irq_ccabusy_state_cca(void)
 
     cca_notify(false);
 }
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 
+#if NRF_802154_ENERGY_DETECTION_ENABLED
 /// This event is generated when energy detection procedure ends.
 static void irq_edend_state_ed(void)
 {
@@ -2401,247 +3318,256 @@ static void irq_edend_state_ed(void)
         energy_detected_notify(ed_result_get());
     }
 }
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
-/// Handler of radio interrupts.
-static void irq_handler(void)
+/// END event in TX_ACK state is handled as PHYEND on revisions without the PHYEND event.
+static void irq_end_state_tx_ack(void)
 {
-    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_IRQ_HANDLER);
-
-    // Prevent interrupting of this handler by requests from higher priority code.
-    nrf_802154_critical_section_forcefully_enter();
-
-    if (nrf_radio_int_get(NRF_RADIO_INT_ADDRESS_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_ADDRESS))
+    if (!nrf_802154_revision_has_phyend_event())
     {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_FRAMESTART);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_ADDRESS);
-
-        switch (m_state)
-        {
-            case RADIO_STATE_CCA_TX:
-            case RADIO_STATE_TX:
-                irq_address_state_tx_frame();
-                break;
-
-            case RADIO_STATE_TX_ACK:
-                irq_address_state_tx_ack();
-                break;
-
-            default:
-                assert(false);
-        }
-
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_FRAMESTART);
+        irq_phyend_state_tx_ack();
     }
+}
 
-#if !NRF_802154_DISABLE_BCC_MATCHING
-    // Check MAC frame header.
-    if (nrf_radio_int_get(NRF_RADIO_INT_BCMATCH_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_BCMATCH))
+/// END event in TX state is handled as PHYEND on revisions without the PHYEND event.
+static void irq_end_state_tx_frame(void)
+{
+    if (!nrf_802154_revision_has_phyend_event())
     {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_BCMATCH);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_BCMATCH);
-
-        switch (m_state)
-        {
-            case RADIO_STATE_RX:
-                irq_bcmatch_state_rx();
-                break;
-
-            default:
-                assert(false);
-        }
-
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_BCMATCH);
+        irq_phyend_state_tx_frame();
     }
+}
 
+/***************************************************************************************************
+ * @section RADIO events dispatching
+ **************************************************************************************************/
+
+#if !NRF_802154_DISABLE_BCC_MATCHING
+#define IRQ_EVENT_BCMATCH(X) X(BCMATCH, FUNCTION_EVENT_BCMATCH)
+#define IRQ_FSM_BCMATCH(X)   X(BCMATCH, RX, irq_bcmatch_state_rx)
+#else
+#define IRQ_EVENT_BCMATCH(X)
+#define IRQ_FSM_BCMATCH(X)
 #endif // !NRF_802154_DISABLE_BCC_MATCHING
 
 #if !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
-    if (nrf_radio_int_get(NRF_RADIO_INT_CRCERROR_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_CRCERROR))
-    {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CRCERROR);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_CRCERROR);
-
-        switch (m_state)
-        {
-            case RADIO_STATE_RX:
-                irq_crcerror_state_rx();
-                break;
-
-            default:
-                assert(false);
-        }
-
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CRCERROR);
-    }
+#define IRQ_EVENT_CRCERROR(X) X(CRCERROR, FUNCTION_EVENT_CRCERROR)
+#define IRQ_FSM_CRCERROR(X)   X(CRCERROR, RX, irq_crcerror_state_rx)
+#else
+#define IRQ_EVENT_CRCERROR(X)
+#define IRQ_FSM_CRCERROR(X)
 #endif // !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
 
-    if (nrf_radio_int_get(NRF_RADIO_INT_CRCOK_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_CRCOK))
-    {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CRCOK);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_CRCOK);
-
-        switch (m_state)
-        {
-            case RADIO_STATE_RX:
-                irq_crcok_state_rx();
-                break;
-
-            default:
-                assert(false);
-        }
-
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CRCOK);
-    }
-
-    if (nrf_802154_revision_has_phyend_event() &&
-        nrf_radio_int_get(NRF_RADIO_INT_PHYEND_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_PHYEND))
-    {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_PHYEND);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_PHYEND);
+#if NRF_802154_CCA_PROCEDURE_ENABLED || NRF_802154_COEX_ENABLED
+#define IRQ_EVENT_CCAIDLE(X) X(CCAIDLE, FUNCTION_EVENT_CCAIDLE)
+#else
+#define IRQ_EVENT_CCAIDLE(X)
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED || NRF_802154_COEX_ENABLED
 
-        switch (m_state)
-        {
-            case RADIO_STATE_TX_ACK:
-                 irq_phyend_state_tx_ack();
-                 break;
+#if NRF_802154_CCA_PROCEDURE_ENABLED
+#define IRQ_FSM_CCAIDLE_CCA(X) X(CCAIDLE, CCA, irq_ccaidle_state_cca)
+#define IRQ_FSM_CCABUSY_CCA(X) X(CCABUSY, CCA, irq_ccabusy_state_cca)
+#else
+#define IRQ_FSM_CCAIDLE_CCA(X)
+#define IRQ_FSM_CCABUSY_CCA(X)
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 
-            case RADIO_STATE_CCA_TX:
-            case RADIO_STATE_TX:
-                irq_phyend_state_tx_frame();
-                break;
+#if NRF_802154_COEX_ENABLED
+#define IRQ_FSM_CCAIDLE_TX(X) X(CCAIDLE, CCA_TX, irq_ccaidle_state_tx_frame)
+#else
+#define IRQ_FSM_CCAIDLE_TX(X)
+#endif // NRF_802154_COEX_ENABLED
 
-            default:
-                assert(false);
-        }
+#if NRF_802154_ENERGY_DETECTION_ENABLED
+#define IRQ_EVENT_EDEND(X) X(EDEND, FUNCTION_EVENT_EDEND)
+#define IRQ_FSM_ED(X)      X(EDEND, ED, irq_edend_state_ed)
+#else
+#define IRQ_EVENT_EDEND(X)
+#define IRQ_FSM_ED(X)
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_PHYEND);
-    }
+/**
+ * @brief RADIO events handled by the core: event name and trace function ID.
+ *
+ * The name refers to NRF_RADIO_EVENT_<name> and RADIO_INTENSET_<name>_Msk. Pending events are
+ * handled in the order of this list.
+ */
+#define IRQ_EVENTS(X)                          \
+    X(ADDRESS, FUNCTION_EVENT_FRAMESTART)      \
+    IRQ_EVENT_BCMATCH(X)                       \
+    IRQ_EVENT_CRCERROR(X)                      \
+    X(CRCOK, FUNCTION_EVENT_CRCOK)             \
+    X(PHYEND, FUNCTION_EVENT_PHYEND)           \
+    X(END, FUNCTION_EVENT_END)                 \
+    X(DISABLED, FUNCTION_EVENT_DISABLED)       \
+    IRQ_EVENT_CCAIDLE(X)                       \
+    X(CCABUSY, FUNCTION_EVENT_CCABUSY)         \
+    IRQ_EVENT_EDEND(X)
 
-    if (nrf_radio_int_get(NRF_RADIO_INT_END_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_END))
-    {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_END);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_END);
+/**
+ * @brief Description of the core FSM: handler of each RADIO event in each state it is expected in.
+ *
+ * A RADIO event that occurs in a state not listed here is a driver error. Entries are grouped by
+ * event in the order of @ref IRQ_EVENTS.
+ */
+#define IRQ_FSM(X)                                                      \
+    X(ADDRESS,  CCA_TX,         irq_address_state_tx_frame)             \
+    X(ADDRESS,  TX,             irq_address_state_tx_frame)             \
+    X(ADDRESS,  TX_ACK,         irq_address_state_tx_ack)               \
+    IRQ_FSM_BCMATCH(X)                                                  \
+    IRQ_FSM_CRCERROR(X)                                                 \
+    X(CRCOK,    RX,             irq_crcok_state_rx)                     \
+    X(PHYEND,   TX_ACK,         irq_phyend_state_tx_ack)                \
+    X(PHYEND,   CCA_TX,         irq_phyend_state_tx_frame)              \
+    X(PHYEND,   TX,             irq_phyend_state_tx_frame)              \
+    X(END,      TX_ACK,         irq_end_state_tx_ack)                   \
+    X(END,      CCA_TX,         irq_end_state_tx_frame)                 \
+    X(END,      TX,             irq_end_state_tx_frame)                 \
+    X(END,      RX_ACK,         irq_end_state_rx_ack)                   \
+    X(DISABLED, FALLING_ASLEEP, irq_disabled_state_falling_asleep)      \
+    IRQ_FSM_CCAIDLE_TX(X)                                               \
+    IRQ_FSM_CCAIDLE_CCA(X)                                              \
+    X(CCABUSY,  CCA_TX,         irq_ccabusy_state_tx_frame)             \
+    X(CCABUSY,  TX,             irq_ccabusy_state_tx_frame)             \
+    IRQ_FSM_CCABUSY_CCA(X)                                              \
+    IRQ_FSM_ED(X)
+
+#define RADIO_STATE_COUNT (RADIO_STATE_CONTINUOUS_CARRIER + 1) ///< Number of states of the core FSM.
 
-        switch (m_state)
-        {
-            case RADIO_STATE_TX_ACK:
-                if (!nrf_802154_revision_has_phyend_event())
-                {
-                    irq_phyend_state_tx_ack();
-                }
+/**
+ * @brief Bit that represents given RADIO event in a bitmap of events.
+ *
+ * The first event of @ref IRQ_EVENTS is the most significant bit, so __CLZ of a bitmap returns the
+ * ID of the first event in the bitmap in the handling order.
+ */
+#define IRQ_EVENT_BIT(event_id) (0x80000000UL >> (event_id))
+
+#define IRQ_EVENT_ID(name, trace_id)       IRQ_EVENT_##name,
+#define IRQ_EVENT_TRACE_ID(name, trace_id) [IRQ_EVENT_##name] = (trace_id),
+#define IRQ_EVENT_REGISTER(name, trace_id) [IRQ_EVENT_##name] = NRF_RADIO_EVENT_##name,
+/// Bit of the event in the bitmap if its interrupt is set in the local variable int_enabled.
+#define IRQ_EVENT_ENABLED_BIT(name, trace_id) \
+    ((int_enabled & RADIO_INTENSET_##name##_Msk) ? IRQ_EVENT_BIT(IRQ_EVENT_##name) : 0UL) |
+#define IRQ_FSM_HANDLER(event, state, handler) \
+    [IRQ_EVENT_##event][RADIO_STATE_##state] = handler,
+
+/// RADIO events handled by the core.
+typedef enum
+{
+    IRQ_EVENTS(IRQ_EVENT_ID)
+    IRQ_EVENT_COUNT
+} irq_event_t;
 
-                break;
+/// Handler of a RADIO event in given state of the core FSM.
+typedef void (* irq_state_handler_t)(void);
 
-            case RADIO_STATE_CCA_TX:
-            case RADIO_STATE_TX:
-                if (!nrf_802154_revision_has_phyend_event())
-                {
-                    irq_phyend_state_tx_frame();
-                }
+/// Handlers of RADIO events in each state of the core FSM.
+NRF_802154_RAM_DATA
+static const irq_state_handler_t m_irq_handlers[IRQ_EVENT_COUNT][RADIO_STATE_COUNT] =
+{
+    IRQ_FSM(IRQ_FSM_HANDLER)
+};
 
-                break;
+/// Trace function IDs of RADIO events.
+NRF_802154_RAM_DATA
+static const uint32_t m_irq_trace_ids[IRQ_EVENT_COUNT] =
+{
+    IRQ_EVENTS(IRQ_EVENT_TRACE_ID)
+};
 
-            case RADIO_STATE_RX_ACK: // Ended receiving of ACK.
-                irq_end_state_rx_ack();
-                break;
+/// RADIO event registers of RADIO events.
+NRF_802154_RAM_DATA
+static const nrf_radio_event_t m_irq_event_registers[IRQ_EVENT_COUNT] =
+{
+    IRQ_EVENTS(IRQ_EVENT_REGISTER)
+};
 
-            default:
-                assert(false);
-        }
+/**
+ * @brief Get bitmap of RADIO events which interrupts are enabled.
+ *
+ * @param[in]  events  Bitmap of events to check.
+ *
+ * @return  Bitmap of events from @p events that should be handled by the IRQ handler.
+ */
+NRF_802154_RAM_CODE
+static uint32_t irq_events_enabled_get(uint32_t events)
+{
+    uint32_t int_enabled = nrf_radio_int_enable_get();
 
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_END);
-    }
+    events &= IRQ_EVENTS(IRQ_EVENT_ENABLED_BIT) 0UL;
 
-    if (nrf_radio_int_get(NRF_RADIO_INT_DISABLED_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_DISABLED))
+    // END event is handled as PHYEND on revisions without the PHYEND event.
+    if ((events & IRQ_EVENT_BIT(IRQ_EVENT_PHYEND)) && !nrf_802154_revision_has_phyend_event())
     {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_DISABLED);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_DISABLED);
-
-        switch (m_state)
-        {
-            case RADIO_STATE_FALLING_ASLEEP:
-                irq_disabled_state_falling_asleep();
-                break;
+        events &= ~IRQ_EVENT_BIT(IRQ_EVENT_PHYEND);
+    }
 
-            default:
-                assert(false);
-        }
+    return events;
+}
 
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_DISABLED);
-    }
+/// Handler of radio interrupts.
+NRF_802154_RAM_CODE
+static void irq_handler(void)
+{
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+    uint32_t start_cycles = DWT->CYCCNT;
+    uint32_t duration;
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
 
-    if (nrf_radio_int_get(NRF_RADIO_INT_CCAIDLE_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_CCAIDLE))
-    {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CCAIDLE);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_CCAIDLE);
+    uint32_t            pending;
+    uint32_t            event_id;
+    nrf_radio_event_t   event;
+    irq_state_handler_t handler;
 
-        switch (m_state)
-        {
-            case RADIO_STATE_CCA:
-                irq_ccaidle_state_cca();
-                break;
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_IRQ_HANDLER);
 
-            default:
-                assert(false);
-        }
+    // Prevent interrupting of this handler by requests from higher priority code.
+    nrf_802154_critical_section_forcefully_enter();
 
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CCAIDLE);
-    }
+    // Events are handled in the order of IRQ_EVENTS, not in the order of INTEN bits. Only events
+    // with enabled interrupts are visited.
+    pending = irq_events_enabled_get(UINT32_MAX);
 
-    if (nrf_radio_int_get(NRF_RADIO_INT_CCABUSY_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_CCABUSY))
+    while (pending != 0UL)
     {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CCABUSY);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_CCABUSY);
+        event_id = __CLZ(pending);
+        pending &= ~IRQ_EVENT_BIT(event_id);
+        event    = m_irq_event_registers[event_id];
 
-        switch (m_state)
+        if (!nrf_radio_event_get(event))
         {
-            case RADIO_STATE_CCA_TX:
-            case RADIO_STATE_TX:
-                irq_ccabusy_state_tx_frame();
-                break;
-
-            case RADIO_STATE_CCA:
-                irq_ccabusy_state_cca();
-                break;
-
-            default:
-                assert(false);
+            continue;
         }
 
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CCABUSY);
-    }
+        nrf_802154_log(EVENT_TRACE_ENTER, m_irq_trace_ids[event_id]);
+        nrf_radio_event_clear(event);
 
-    if (nrf_radio_int_get(NRF_RADIO_INT_EDEND_MASK) &&
-        nrf_radio_event_get(NRF_RADIO_EVENT_EDEND))
-    {
-        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_EDEND);
-        nrf_radio_event_clear(NRF_RADIO_EVENT_EDEND);
+        handler = m_irq_handlers[event_id][m_state];
+        assert(handler != NULL);
 
-        switch (m_state)
+        if (handler != NULL)
         {
-            case RADIO_STATE_ED:
-                irq_edend_state_ed();
-                break;
-
-            default:
-                assert(false);
+            handler();
         }
 
-        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_EDEND);
+        nrf_802154_log(EVENT_TRACE_EXIT, m_irq_trace_ids[event_id]);
+
+        // The handler may have enabled or disabled interrupts of the remaining events.
+        pending = irq_events_enabled_get(IRQ_EVENT_BIT(event_id) - 1UL);
     }
 
     nrf_802154_critical_section_exit();
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_IRQ_HANDLER);
+
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+    duration = DWT->CYCCNT - start_cycles;
+
+    if (duration > m_irq_max_duration)
+    {
+        m_irq_max_duration = duration;
+    }
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
 }
 
 
@@ -2655,6 +3581,18 @@ void nrf_802154_core_init(void)
     memcpy(m_ack_psdu, ack_psdu, sizeof(ack_psdu));
 
     m_state = RADIO_STATE_SLEEP;
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+    m_radio_cfg_retained = false;
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+    m_tx_trigger_is_set = false;
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+    m_irq_max_duration = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
 
     nrf_timer_init();
 }
@@ -2667,6 +3605,7 @@ void nrf_802154_core_deinit(void)
     }
     
     nrf_fem_control_pin_clear();
+    nrf_fem_control_power_down();
     nrf_fem_control_deactivate();
     
     irq_deinit();
@@ -2759,15 +3698,23 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
             mp_tx_data = p_data;
             result     = tx_init(p_data, cca, true);
 
-            if (!immediate)
+            if (result && !tx_coex_grant_check(cca))
             {
-                result = true;
+                // The request is accepted, but the medium is used by a co-located radio.
+                tx_coex_denied();
             }
-        }
+            else
+            {
+                if (!immediate)
+                {
+                    result = true;
+                }
 
-        if (result)
-        {
-            state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+                if (result)
+                {
+                    state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+                }
+            }
         }
 
         if (notify_function != NULL)
@@ -2788,8 +3735,23 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
     return result;
 }
 
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+void nrf_802154_core_tx_trigger_set(uint32_t trigger_time)
+{
+    m_tx_trigger_time   = trigger_time;
+    __DMB();
+    m_tx_trigger_is_set = true;
+}
+
+void nrf_802154_core_tx_trigger_clear(void)
+{
+    m_tx_trigger_is_set = false;
+}
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
+#if NRF_802154_ENERGY_DETECTION_ENABLED
     bool result = critical_section_enter();
 
     if (result)
@@ -2808,10 +3770,17 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
     }
 
     return result;
+#else // NRF_802154_ENERGY_DETECTION_ENABLED
+    (void)term_lvl;
+    (void)time_us;
+
+    return false;
+#endif // NRF_802154_ENERGY_DETECTION_ENABLED
 }
 
 bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 {
+#if NRF_802154_CCA_PROCEDURE_ENABLED
     bool result = critical_section_enter();
 
     if (result)
@@ -2828,10 +3797,16 @@ bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
     }
 
     return result;
+#else // NRF_802154_CCA_PROCEDURE_ENABLED
+    (void)term_lvl;
+
+    return false;
+#endif // NRF_802154_CCA_PROCEDURE_ENABLED
 }
 
 bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
 {
+#if NRF_802154_CONTINUOUS_CARRIER_ENABLED
     bool result = critical_section_enter();
 
     if (result)
@@ -2848,6 +3823,60 @@ bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
     }
 
     return result;
+#else // NRF_802154_CONTINUOUS_CARRIER_ENABLED
+    (void)term_lvl;
+
+    return false;
+#endif // NRF_802154_CONTINUOUS_CARRIER_ENABLED
+}
+
+/** Start receiver waiting for a free buffer.
+ *
+ * @param[in]  p_buffer  Pointer to a free buffer to receive a frame to.
+ */
+static void rx_restart_on_buffer_free(rx_buffer_t * p_buffer)
+{
+    if (!timeslot_is_granted())
+    {
+        return;
+    }
+
+    switch (m_state)
+    {
+        case RADIO_STATE_RX:
+            if (nrf_radio_state_get() == NRF_RADIO_STATE_RX_IDLE)
+            {
+                assert(nrf_radio_shorts_get() == SHORTS_RX);
+
+                rx_buffer_in_use_set(p_buffer);
+
+                nrf_radio_packet_ptr_set(rx_buffer_get());
+                nrf_radio_shorts_set(SHORTS_RX | SHORTS_RX_FREE_BUFFER);
+
+                nrf_radio_task_trigger(NRF_RADIO_TASK_START);
+            }
+
+            break;
+
+        case RADIO_STATE_RX_ACK:
+            if (nrf_radio_state_get() == NRF_RADIO_STATE_RX_IDLE)
+            {
+                assert(nrf_radio_shorts_get() == SHORTS_RX_ACK);
+
+                rx_buffer_in_use_set(p_buffer);
+
+                nrf_radio_packet_ptr_set(rx_buffer_get());
+                nrf_radio_shorts_set(SHORTS_RX_ACK | SHORTS_RX_FREE_BUFFER);
+
+                nrf_radio_task_trigger(NRF_RADIO_TASK_START);
+            }
+
+            break;
+
+        default:
+            // Don't perform any action in any other state (receiver should not be started).
+            break;
+    }
 }
 
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
@@ -2859,51 +3888,130 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
 
     if (in_crit_sect)
     {
-        if (timeslot_is_granted())
+        rx_restart_on_buffer_free(p_buffer);
+
+        nrf_802154_critical_section_exit();
+    }
+
+    return true;
+}
+
+bool nrf_802154_core_notify_buffer_free_batch(uint8_t * const * pp_data, uint8_t count)
+{
+    bool in_crit_sect = critical_section_enter();
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        ((rx_buffer_t *)pp_data[i])->free = true;
+    }
+
+    if (in_crit_sect)
+    {
+        if (count > 0)
         {
-            switch (m_state)
-            {
-                case RADIO_STATE_RX:
-                    if (nrf_radio_state_get() == NRF_RADIO_STATE_RX_IDLE)
-                    {
-                        assert(nrf_radio_shorts_get() == SHORTS_RX);
+            // Receiver needs a single buffer to restart. Other buffers are found when needed.
+            rx_restart_on_buffer_free((rx_buffer_t *)pp_data[0]);
+        }
 
-                        rx_buffer_in_use_set(p_buffer);
+        nrf_802154_critical_section_exit();
+    }
 
-                        nrf_radio_packet_ptr_set(rx_buffer_get());
-                        nrf_radio_shorts_set(SHORTS_RX | SHORTS_RX_FREE_BUFFER);
+    return true;
+}
 
-                        nrf_radio_task_trigger(NRF_RADIO_TASK_START);
-                    }
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+bool nrf_802154_core_notify_buffer_donated(uint8_t * p_data)
+{
+    rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
+    bool          in_crit_sect = critical_section_enter();
+    bool          result       = nrf_802154_rx_buffer_donated_add(p_buffer);
 
-                    break;
+    if (in_crit_sect)
+    {
+        if (result)
+        {
+            rx_restart_on_buffer_free(p_buffer);
+        }
 
-                case RADIO_STATE_RX_ACK:
-                    if (nrf_radio_state_get() == NRF_RADIO_STATE_RX_IDLE)
-                    {
-                        assert(nrf_radio_shorts_get() == SHORTS_RX_ACK);
+        nrf_802154_critical_section_exit();
+    }
 
-                        rx_buffer_in_use_set(p_buffer);
+    return result;
+}
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
 
-                        nrf_radio_packet_ptr_set(rx_buffer_get());
-                        nrf_radio_shorts_set(SHORTS_RX_ACK | SHORTS_RX_FREE_BUFFER);
+void nrf_802154_core_rx_overflow_stats_get(nrf_802154_rx_overflow_stats_t * p_stats)
+{
+    *p_stats = m_rx_overflow_stats;
+}
 
-                        nrf_radio_task_trigger(NRF_RADIO_TASK_START);
-                    }
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+/** Process data of an accepted frame captured by @ref rx_frame_accepted. */
+static void bh_rx_accepted_process(const bh_rx_accepted_t * p_accepted)
+{
+#if NRF_802154_ANT_DIV_ENABLED
+    // Antenna diversity tables are used by the RADIO IRQ handler. If the critical section cannot
+    // be entered, the sample of this frame is dropped.
+    if (nrf_802154_critical_section_enter())
+    {
+        nrf_802154_ant_div_ctrl_frame_received(p_accepted->p_psdu,
+                                               rssi_from_sample_get(p_accepted->rssi_sample),
+                                               p_accepted->antenna);
+
+        nrf_802154_critical_section_exit();
+    }
+#endif // NRF_802154_ANT_DIV_ENABLED
+
+#if NRF_802154_GP_RX_AFTER_TX_ENABLED
+    if (p_accepted->timestamp_valid)
+    {
+        nrf_802154_gp_rx_after_tx_frame_received(p_accepted->p_psdu, p_accepted->timestamp);
+    }
+#endif // NRF_802154_GP_RX_AFTER_TX_ENABLED
 
-                    break;
+    (void)p_accepted;
+}
 
-                default:
-                    // Don't perform any action in any other state (receiver should not be started).
-                    break;
+void nrf_802154_core_irq_bottom_half(void)
+{
+    while (m_bh_rx_r_ptr != m_bh_rx_w_ptr)
+    {
+        const bh_rx_event_t * p_event = &m_bh_rx_queue[m_bh_rx_r_ptr];
+
+        if (p_event->p_psdu == NULL)
+        {
+            nrf_802154_notify_receive_failed(p_event->error);
+        }
+        else
+        {
+            if (p_event->accepted.p_psdu != NULL)
+            {
+                bh_rx_accepted_process(&p_event->accepted);
             }
+
+            nrf_802154_notify_received(p_event->p_psdu,
+                                       rssi_from_sample_get(p_event->rssi_sample),
+                                       lqi_get(p_event->p_psdu));
         }
 
-        nrf_802154_critical_section_exit();
+        m_bh_rx_r_ptr = (m_bh_rx_r_ptr + 1) % BH_RX_QUEUE_SIZE;
+    }
+}
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+uint32_t nrf_802154_core_irq_max_duration_get(bool reset)
+{
+    uint32_t result = m_irq_max_duration;
+
+    if (reset)
+    {
+        m_irq_max_duration = 0;
     }
 
-    return true;
+    return result;
 }
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
 
 bool nrf_802154_core_channel_update(void)
 {
@@ -154,6 +154,24 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               bool                           immediate,
                               nrf_802154_notification_func_t notify_function);
 
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+/**
+ * @brief Set time at which ramp up of the next requested transmission should be started.
+ *
+ * When the next transmission is initialized, the ramp up is triggered at @p trigger_time by
+ * the High Precision Timer. If the HP timer is not synchronized or @p trigger_time is too close,
+ * the ramp up is started immediately.
+ *
+ * @param[in]  trigger_time  Absolute time of the ramp up start [us].
+ */
+void nrf_802154_core_tx_trigger_set(uint32_t trigger_time);
+
+/**
+ * @brief Clear time set by @ref nrf_802154_core_tx_trigger_set.
+ */
+void nrf_802154_core_tx_trigger_clear(void);
+#endif // NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+
 /**
  * @brief Request transition to ENERGY_DETECTION state.
  *
@@ -214,6 +232,34 @@ bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl);
  */
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data);
 
+/**
+ * @brief Notify the Core module that higher layer freed a number of frame buffers.
+ *
+ * All buffers are returned to the driver and the receiver is restarted at most once.
+ *
+ * @note This function shall be called from a critical section context. It shall not be interrupted
+ *       by the RADIO event handler or Radio Scheduler notification.
+ *
+ * @param[in]  pp_data  Array of pointers to buffers that have been freed.
+ * @param[in]  count    Number of elements in @p pp_data.
+ */
+bool nrf_802154_core_notify_buffer_free_batch(uint8_t * const * pp_data, uint8_t count);
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+/**
+ * @brief Notify the Core module that higher layer donated a buffer to receive a frame to.
+ *
+ * @note This function shall be called from a critical section context. It shall not be interrupted
+ *       by the RADIO event handler or Radio Scheduler notification.
+ *
+ * @param[in]  p_data  Pointer to the donated buffer.
+ *
+ * @retval true   The buffer was accepted by the driver.
+ * @retval false  The driver already holds the maximal number of donated buffers.
+ */
+bool nrf_802154_core_notify_buffer_donated(uint8_t * p_data);
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
 /**
  * @brief Notify the Core module that next higher layer requested change of the channel.
  *
@@ -227,6 +273,36 @@ bool nrf_802154_core_channel_update(void);
  */
 bool nrf_802154_core_cca_cfg_update(void);
 
+/**
+ * @brief Get statistics of receive buffer overflows.
+ *
+ * @param[out]  p_stats  Pointer to the structure filled with the statistics.
+ */
+void nrf_802154_core_rx_overflow_stats_get(nrf_802154_rx_overflow_stats_t * p_stats);
+
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+/**
+ * @brief Process RADIO IRQ work deferred from the RADIO IRQ handler.
+ *
+ * Received frames and reception failures are processed and notified in the order in which
+ * the RADIO IRQ handler queued them.
+ *
+ * This function is called at SWI priority level after the RADIO IRQ handler triggered it.
+ */
+void nrf_802154_core_irq_bottom_half(void);
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+
+#if NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+/**
+ * @brief Get the longest execution time of the RADIO IRQ handler.
+ *
+ * @param[in]  reset  If the measurement should be restarted.
+ *
+ * @returns  The longest execution time since initialization or last reset [CPU cycles].
+ */
+uint32_t nrf_802154_core_irq_max_duration_get(bool reset);
+#endif // NRF_802154_IRQ_DURATION_MEASUREMENT_ENABLED
+
 #if !NRF_802154_INTERNAL_IRQ_HANDLING
 /**
  * @brief Notify the Core module that there is a pending IRQ that should be handled.
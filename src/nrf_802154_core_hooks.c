@@ -42,7 +42,13 @@
 #include <stdbool.h>
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_ant_div_ctrl.h"
 #include "mac_features/nrf_802154_csma_ca.h"
+#include "mac_features/nrf_802154_rx_window.h"
+#include "mac_features/nrf_802154_tx_buffer.h"
+#include "mac_features/nrf_802154_tx_desc.h"
+#include "mac_features/nrf_802154_tx_power_ctrl.h"
+#include "mac_features/nrf_802154_tx_sg.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 
@@ -67,6 +73,30 @@ static const abort_hook m_abort_hooks[] =
     nrf_802154_ack_timeout_abort,
 #endif
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+    nrf_802154_rx_window_abort,
+#endif
+
+#if NRF_802154_TX_SG_ENABLED
+    nrf_802154_tx_sg_abort,
+#endif
+
+#if !NRF_802154_USE_RAW_API
+    nrf_802154_tx_buffer_abort,
+#endif
+
+#if NRF_802154_TX_POWER_CTRL_ENABLED
+    nrf_802154_tx_power_ctrl_abort,
+#endif
+
+#if NRF_802154_ANT_DIV_ENABLED
+    nrf_802154_ant_div_ctrl_abort,
+#endif
+
+#if NRF_802154_TX_EX_ENABLED
+    nrf_802154_tx_desc_abort,
+#endif
+
     NULL,
 };
 
@@ -76,11 +106,41 @@ static const transmitted_hook m_transmitted_hooks[] =
     nrf_802154_ack_timeout_transmitted_hook,
 #endif
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+    nrf_802154_rx_window_transmitted_hook,
+#endif
+
+#if NRF_802154_TX_SG_ENABLED
+    nrf_802154_tx_sg_transmitted_hook,
+#endif
+
+#if !NRF_802154_USE_RAW_API
+    nrf_802154_tx_buffer_transmitted_hook,
+#endif
+
+#if NRF_802154_ANT_DIV_ENABLED
+    nrf_802154_ant_div_ctrl_transmitted_hook,
+#endif
+
+#if NRF_802154_TX_EX_ENABLED
+    nrf_802154_tx_desc_transmitted_hook,
+#endif
+
     NULL,
 };
 
 static const tx_failed_hook m_tx_failed_hooks[] =
 {
+    // Transmit power control and antenna diversity must see all failures, including those handled
+    // by CSMA-CA.
+#if NRF_802154_TX_POWER_CTRL_ENABLED
+    nrf_802154_tx_power_ctrl_tx_failed_hook,
+#endif
+
+#if NRF_802154_ANT_DIV_ENABLED
+    nrf_802154_ant_div_ctrl_tx_failed_hook,
+#endif
+
 #if NRF_802154_CSMA_CA_ENABLED
     nrf_802154_csma_ca_tx_failed_hook,
 #endif
@@ -89,6 +149,22 @@ static const tx_failed_hook m_tx_failed_hooks[] =
     nrf_802154_ack_timeout_tx_failed_hook,
 #endif
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+    nrf_802154_rx_window_tx_failed_hook,
+#endif
+
+#if NRF_802154_TX_SG_ENABLED
+    nrf_802154_tx_sg_tx_failed_hook,
+#endif
+
+#if !NRF_802154_USE_RAW_API
+    nrf_802154_tx_buffer_tx_failed_hook,
+#endif
+
+#if NRF_802154_TX_EX_ENABLED
+    nrf_802154_tx_desc_tx_failed_hook,
+#endif
+
     NULL,
 };
 
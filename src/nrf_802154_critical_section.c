@@ -42,6 +42,7 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_rsch.h"
+#include "nrf_802154_utils.h"
 #include "hal/nrf_radio.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
 
@@ -51,9 +52,12 @@
 
 #define NESTED_CRITICAL_SECTION_ALLOWED_PRIORITY_NONE (-1)
 
-static volatile uint8_t m_critical_section_monitor;                  ///< Monitors each critical section enter operation
-static volatile uint8_t m_nested_critical_section_counter;           ///< Counter of nested critical sections
-static volatile int8_t  m_nested_critical_section_allowed_priority;  ///< Indicator if nested critical sections are currently allowed
+static volatile uint8_t NRF_802154_PER_INSTANCE(m_critical_section_monitor);                 ///< Monitors each critical section enter operation
+static volatile uint8_t NRF_802154_PER_INSTANCE(m_nested_critical_section_counter);          ///< Counter of nested critical sections
+static volatile int8_t  NRF_802154_PER_INSTANCE(m_nested_critical_section_allowed_priority); ///< Indicator if nested critical sections are currently allowed
+#define m_critical_section_monitor                 NRF_802154_INSTANCE_OF(m_critical_section_monitor)
+#define m_nested_critical_section_counter          NRF_802154_INSTANCE_OF(m_nested_critical_section_counter)
+#define m_nested_critical_section_allowed_priority NRF_802154_INSTANCE_OF(m_nested_critical_section_allowed_priority)
 
 typedef enum
 {
@@ -62,7 +66,8 @@ typedef enum
     RSCH_EVT_ENDED,
 } rsch_evt_t;
 
-static volatile uint8_t m_rsch_pending_evt;  ///< Indicator of pending RSCH event.
+static volatile uint8_t NRF_802154_PER_INSTANCE(m_rsch_pending_evt); ///< Indicator of pending RSCH event.
+#define m_rsch_pending_evt NRF_802154_INSTANCE_OF(m_rsch_pending_evt)
 
 
 /***************************************************************************************************
@@ -234,7 +239,8 @@ static void critical_section_exit(void)
     rsch_evt_t  rsch_evt = RSCH_EVT_NONE;
     uint8_t     monitor;
     uint8_t     atomic_cnt;
-    static bool exiting_crit_sect;
+    static bool NRF_802154_PER_INSTANCE(exiting_crit_sect);
+#define exiting_crit_sect NRF_802154_INSTANCE_OF(exiting_crit_sect)
     bool        result;
 
     assert(cnt > 0);
@@ -291,6 +297,7 @@ static void critical_section_exit(void)
         }
     }
     while (cnt == 1);
+#undef exiting_crit_sect
 }
 
 /***************************************************************************************************
@@ -57,6 +57,16 @@ extern "C" {
  */
 typedef void (*nrf_802154_notification_func_t)(bool result);
 
+/**
+ * @brief Function type used to select received frames which notifications can be withdrawn.
+ *
+ * @param[in]  p_data  Array of bytes containing PSDU of the received frame.
+ *
+ * @retval true   Notification about the frame can be withdrawn.
+ * @retval false  Notification about the frame must be delivered.
+ */
+typedef bool (*nrf_802154_notification_received_filter_t)(const uint8_t * p_data);
+
 /**
  * @brief Initialize notification module.
  */
@@ -71,6 +81,19 @@ void nrf_802154_notification_init(void);
  */
 void nrf_802154_notify_received(uint8_t * p_data, int8_t power, int8_t lqi);
 
+/**
+ * @brief Withdraw the oldest undelivered notification about a received frame.
+ *
+ * Only notifications about frames accepted by @p filter are considered. The buffer of the
+ * withdrawn frame is returned to the caller and the frame is never delivered to the next higher
+ * layer.
+ *
+ * @param[in]  filter  Function selecting frames which notifications can be withdrawn.
+ *
+ * @return  Pointer to PSDU of the withdrawn frame or NULL if there is no such notification.
+ */
+uint8_t * nrf_802154_notify_received_withdraw(nrf_802154_notification_received_filter_t filter);
+
 /**
  * @brief Notify next higher layer that reception of a frame failed.
  *
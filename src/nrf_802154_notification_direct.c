@@ -40,8 +40,13 @@
 #include <stdint.h>
 
 #include "nrf_802154.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_critical_section.h"
 
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+#error NRF_802154_IRQ_BOTTOM_HALF_ENABLED requires the SWI variant of notifications
+#endif
+
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
 
@@ -59,6 +64,14 @@ void nrf_802154_notify_received(uint8_t * p_data, int8_t power, int8_t lqi)
 #endif // NRF_802154_USE_RAW_API
 }
 
+uint8_t * nrf_802154_notify_received_withdraw(nrf_802154_notification_received_filter_t filter)
+{
+    // Frames are delivered synchronously. There is no undelivered notification to withdraw.
+    (void)filter;
+
+    return NULL;
+}
+
 void nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error)
 {
     nrf_802154_receive_failed(error);
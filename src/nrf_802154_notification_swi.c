@@ -52,6 +52,11 @@ void nrf_802154_notify_received(uint8_t * p_data, int8_t power, int8_t lqi)
     nrf_802154_swi_notify_received(p_data, power, lqi);
 }
 
+uint8_t * nrf_802154_notify_received_withdraw(nrf_802154_notification_received_filter_t filter)
+{
+    return nrf_802154_swi_notify_received_withdraw(filter);
+}
+
 void nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error)
 {
     nrf_802154_swi_notify_receive_failed(error);
@@ -43,6 +43,7 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
 
 typedef struct
 {
@@ -51,20 +52,25 @@ typedef struct
     uint8_t              short_addr[SHORT_ADDRESS_SIZE];          ///< Short Address of this node.
     uint8_t              extended_addr[EXTENDED_ADDRESS_SIZE];    ///< Extended Address of this node.
     nrf_802154_cca_cfg_t cca;                                     ///< CCA mode and thresholds.
+    uint32_t             rx_window_after_tx;                      ///< Time of reception after transmission if receiver is disabled when idle [us].
     bool                 promiscuous                          :1; ///< Indicating if radio is in promiscuous mode.
     bool                 auto_ack                             :1; ///< Indicating if auto ACK procedure is enabled.
     bool                 pan_coord                            :1; ///< Indicating if radio is configured as the PAN coordinator.
+    bool                 rx_on_when_idle                      :1; ///< Indicating if receiver should be enabled when radio is idle.
     uint8_t              channel                              :5; ///< Channel on which the node receives messages.
 } nrf_802154_pib_data_t;
 
-static nrf_802154_pib_data_t m_data;  ///< Buffer containing PIB data.
+static nrf_802154_pib_data_t NRF_802154_PER_INSTANCE(m_data); ///< Buffer containing PIB data.
+#define m_data NRF_802154_INSTANCE_OF(m_data)
 
 void nrf_802154_pib_init(void)
 {
-    m_data.promiscuous = false;
-    m_data.auto_ack    = true;
-    m_data.pan_coord   = false;
-    m_data.channel     = 11;
+    m_data.promiscuous        = false;
+    m_data.auto_ack           = true;
+    m_data.pan_coord          = false;
+    m_data.rx_on_when_idle    = true;
+    m_data.rx_window_after_tx = 0;
+    m_data.channel            = 11;
 
     memset(m_data.pan_id, 0xff, sizeof(m_data.pan_id));
     m_data.short_addr[0] = 0xfe;
@@ -107,6 +113,26 @@ void nrf_802154_pib_pan_coord_set(bool enabled)
     m_data.pan_coord = enabled;
 }
 
+bool nrf_802154_pib_rx_on_when_idle_get(void)
+{
+    return m_data.rx_on_when_idle;
+}
+
+void nrf_802154_pib_rx_on_when_idle_set(bool enabled)
+{
+    m_data.rx_on_when_idle = enabled;
+}
+
+uint32_t nrf_802154_pib_rx_window_after_tx_get(void)
+{
+    return m_data.rx_window_after_tx;
+}
+
+void nrf_802154_pib_rx_window_after_tx_set(uint32_t time)
+{
+    m_data.rx_window_after_tx = time;
+}
+
 uint8_t nrf_802154_pib_channel_get(void)
 {
     return m_data.channel;
@@ -122,7 +148,7 @@ int8_t nrf_802154_pib_tx_power_get(void)
     return m_data.tx_power;
 }
 
-void nrf_802154_pib_tx_power_set(int8_t dbm)
+int8_t nrf_802154_pib_tx_power_round(int8_t dbm)
 {
     const int8_t allowed_values[] = {-40, -20, -16, -12, -8, -4, 0, 2, 3, 4, 5, 6, 7, 8, 9};
     const int8_t highest_value    = allowed_values[(sizeof(allowed_values) / sizeof(allowed_values[0])) - 1];
@@ -142,7 +168,12 @@ void nrf_802154_pib_tx_power_set(int8_t dbm)
         }
     }
 
-    m_data.tx_power = dbm;
+    return dbm;
+}
+
+void nrf_802154_pib_tx_power_set(int8_t dbm)
+{
+    m_data.tx_power = nrf_802154_pib_tx_power_round(dbm);
 }
 
 const uint8_t * nrf_802154_pib_pan_id_get(void)
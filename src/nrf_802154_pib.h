@@ -95,6 +95,35 @@ bool nrf_802154_pib_pan_coord_get(void);
  */
 void nrf_802154_pib_pan_coord_set(bool enabled);
 
+/**
+ * @brief Check if receiver should be enabled when radio is idle.
+ *
+ * @retval  true   If receiver is enabled when radio is idle.
+ * @retval  false  If radio falls asleep when transmission procedure ends.
+ */
+bool nrf_802154_pib_rx_on_when_idle_get(void);
+
+/**
+ * @brief Enable or disable receiver when radio is idle.
+ *
+ * @param[in]  enabled  If receiver should be enabled when radio is idle.
+ */
+void nrf_802154_pib_rx_on_when_idle_set(bool enabled);
+
+/**
+ * @brief Get time of reception after transmission if receiver is disabled when idle.
+ *
+ * @returns  Time of the receive window [us]. 0 if radio falls asleep directly after transmission.
+ */
+uint32_t nrf_802154_pib_rx_window_after_tx_get(void);
+
+/**
+ * @brief Set time of reception after transmission if receiver is disabled when idle.
+ *
+ * @param[in]  time  Time of the receive window [us].
+ */
+void nrf_802154_pib_rx_window_after_tx_set(uint32_t time);
+
 
 /**
  * @brief Get currently used channel.
@@ -124,6 +153,15 @@ int8_t nrf_802154_pib_tx_power_get(void);
  */
 void nrf_802154_pib_tx_power_set(int8_t dbm);
 
+/**
+ * @brief Round transmit power up to the closest value supported by RADIO.
+ *
+ * @param[in]  dbm  Transmit power [dBm].
+ *
+ * @returns  Supported transmit power [dBm].
+ */
+int8_t nrf_802154_pib_tx_power_round(int8_t dbm);
+
 /**
  * @brief Get PAN Id used by this device.
  *
@@ -140,6 +140,23 @@ bool nrf_802154_request_continuous_carrier(nrf_802154_term_t term_lvl);
  */
 bool nrf_802154_request_buffer_free(uint8_t * p_data);
 
+/**
+ * @brief Request the driver to free given buffers.
+ *
+ * @param[in]  pp_data  Array of pointers to the buffers to free.
+ * @param[in]  count    Number of elements in @p pp_data.
+ */
+bool nrf_802154_request_buffer_free_batch(uint8_t * const * pp_data, uint8_t count);
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+/**
+ * @brief Request the driver to use given buffer to receive a frame.
+ *
+ * @param[in]  p_data  Pointer to the donated buffer.
+ */
+bool nrf_802154_request_buffer_donate(uint8_t * p_data);
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
 /**
  * @brief Request the driver to update channel number used by the RADIO peripheral.
  */
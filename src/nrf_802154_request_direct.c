@@ -98,6 +98,18 @@ bool nrf_802154_request_buffer_free(uint8_t * p_data)
     REQUEST_FUNCTION(nrf_802154_core_notify_buffer_free, p_data)
 }
 
+bool nrf_802154_request_buffer_free_batch(uint8_t * const * pp_data, uint8_t count)
+{
+    REQUEST_FUNCTION(nrf_802154_core_notify_buffer_free_batch, pp_data, count)
+}
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+bool nrf_802154_request_buffer_donate(uint8_t * p_data)
+{
+    REQUEST_FUNCTION(nrf_802154_core_notify_buffer_donated, p_data)
+}
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
 bool nrf_802154_request_channel_update(void)
 {
     REQUEST_FUNCTION(nrf_802154_core_channel_update)
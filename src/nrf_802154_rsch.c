@@ -4,13 +4,22 @@
 #include <stddef.h>
 #include <nrf.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_utils.h"
 #include "platform/clock/nrf_802154_clock.h"
 #include "raal/nrf_raal_api.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #define PREC_RAMP_UP_TIME 300  ///< Ramp-up time of preconditions [us]. 300 is worst case for HFclock
 
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+#define HFCLK_STARTUP_BUCKET_WIDTH 31    ///< Width of a bucket in the histogram of HFCLK startup times [us]. Equal to the LP timer tick rounded up.
+#define HFCLK_STARTUP_BUCKETS_NUM  32    ///< Number of buckets in the histogram of HFCLK startup times.
+#define HFCLK_STARTUP_MIN_SAMPLES  8     ///< Number of samples required to use the learned startup time.
+#define HFCLK_STARTUP_MAX_SAMPLES  1024  ///< Number of samples after which the histogram is aged.
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
+
 typedef enum
 {
     RSCH_PREC_STATE_IDLE,
@@ -18,16 +27,44 @@ typedef enum
     RSCH_PREC_STATE_APPROVED,
 } rsch_prec_state_t;
 
-static volatile uint8_t           m_mutex;                      ///< Mutex for notyfying core.
-static volatile uint8_t           m_mutex_monitor;              ///< Mutex monitor, incremented every failed mutex lock.
-static volatile bool              m_last_notified_approved;     ///< Last reported state was approved.
-static volatile rsch_prec_state_t m_prec_states[RSCH_PREC_CNT]; ///< State of all preconditions.
-static bool                       m_in_cont_mode;               ///< If RSCH operates in continuous mode.
-
-static bool               m_delayed_timeslot_is_scheduled;  ///< If delayed timeslot is scheduled at the moment.
-static uint32_t           m_delayed_timeslot_t0;            ///< Time base of the delayed timeslot trigger time.
-static uint32_t           m_delayed_timeslot_dt;            ///< Time delta of the delayed timeslot trigger time.
-static nrf_802154_timer_t m_timer;                          ///< Timer used to trigger delayed timeslot.
+static volatile uint8_t           NRF_802154_PER_INSTANCE(m_mutex);                      ///< Mutex for notyfying core.
+static volatile uint8_t           NRF_802154_PER_INSTANCE(m_mutex_monitor);              ///< Mutex monitor, incremented every failed mutex lock.
+static volatile bool              NRF_802154_PER_INSTANCE(m_last_notified_approved);     ///< Last reported state was approved.
+static volatile rsch_prec_state_t NRF_802154_PER_INSTANCE(m_prec_states)[RSCH_PREC_CNT]; ///< State of all preconditions.
+static bool                       NRF_802154_PER_INSTANCE(m_in_cont_mode);               ///< If RSCH operates in continuous mode.
+#define m_mutex                  NRF_802154_INSTANCE_OF(m_mutex)
+#define m_mutex_monitor          NRF_802154_INSTANCE_OF(m_mutex_monitor)
+#define m_last_notified_approved NRF_802154_INSTANCE_OF(m_last_notified_approved)
+#define m_prec_states            NRF_802154_INSTANCE_OF(m_prec_states)
+#define m_in_cont_mode           NRF_802154_INSTANCE_OF(m_in_cont_mode)
+
+static bool               NRF_802154_PER_INSTANCE(m_delayed_timeslot_is_scheduled); ///< If delayed timeslot is scheduled at the moment.
+static uint32_t           NRF_802154_PER_INSTANCE(m_delayed_timeslot_t0);           ///< Time base of the delayed timeslot trigger time.
+static uint32_t           NRF_802154_PER_INSTANCE(m_delayed_timeslot_dt);           ///< Time delta of the delayed timeslot trigger time.
+static uint32_t           NRF_802154_PER_INSTANCE(m_delayed_timeslot_ramp_up_time); ///< Ramp-up time of preconditions of the delayed timeslot.
+static nrf_802154_timer_t NRF_802154_PER_INSTANCE(m_timer);                         ///< Timer used to trigger delayed timeslot.
+#define m_delayed_timeslot_is_scheduled NRF_802154_INSTANCE_OF(m_delayed_timeslot_is_scheduled)
+#define m_delayed_timeslot_t0           NRF_802154_INSTANCE_OF(m_delayed_timeslot_t0)
+#define m_delayed_timeslot_dt           NRF_802154_INSTANCE_OF(m_delayed_timeslot_dt)
+#define m_delayed_timeslot_ramp_up_time NRF_802154_INSTANCE_OF(m_delayed_timeslot_ramp_up_time)
+#define m_timer                         NRF_802154_INSTANCE_OF(m_timer)
+
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+static uint16_t           NRF_802154_PER_INSTANCE(m_hfclk_startup_hist)[HFCLK_STARTUP_BUCKETS_NUM]; ///< Histogram of HFCLK startup times.
+static uint16_t           NRF_802154_PER_INSTANCE(m_hfclk_startup_samples);                         ///< Number of samples in the histogram.
+static volatile uint32_t  NRF_802154_PER_INSTANCE(m_hfclk_startup_time);                            ///< Learned HFCLK startup time [us].
+static uint32_t           NRF_802154_PER_INSTANCE(m_hfclk_start_timestamp);                         ///< Time when HFCLK start was requested.
+static volatile bool      NRF_802154_PER_INSTANCE(m_hfclk_start_is_measured);                       ///< If startup time of the HFCLK being started is measured.
+static volatile uint8_t   NRF_802154_PER_INSTANCE(m_hfclk_is_lingering);                            ///< If HFCLK is kept running after it was released.
+static nrf_802154_timer_t NRF_802154_PER_INSTANCE(m_hfclk_linger_timer);                            ///< Timer used to stop lingering HFCLK.
+#define m_hfclk_startup_hist      NRF_802154_INSTANCE_OF(m_hfclk_startup_hist)
+#define m_hfclk_startup_samples   NRF_802154_INSTANCE_OF(m_hfclk_startup_samples)
+#define m_hfclk_startup_time      NRF_802154_INSTANCE_OF(m_hfclk_startup_time)
+#define m_hfclk_start_timestamp   NRF_802154_INSTANCE_OF(m_hfclk_start_timestamp)
+#define m_hfclk_start_is_measured NRF_802154_INSTANCE_OF(m_hfclk_start_is_measured)
+#define m_hfclk_is_lingering      NRF_802154_INSTANCE_OF(m_hfclk_is_lingering)
+#define m_hfclk_linger_timer      NRF_802154_INSTANCE_OF(m_hfclk_linger_timer)
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
 
 /** @brief Non-blocking mutex for notifying core.
  *
@@ -74,7 +111,7 @@ static bool any_prec_should_be_requested_for_delayed_timeslot(void)
 {
     uint32_t now = nrf_802154_timer_sched_time_get();
     uint32_t t0  = m_delayed_timeslot_t0;
-    uint32_t dt  = m_delayed_timeslot_dt - PREC_RAMP_UP_TIME -
+    uint32_t dt  = m_delayed_timeslot_dt - m_delayed_timeslot_ramp_up_time -
             nrf_802154_timer_sched_granularity_get();
 
     return (m_delayed_timeslot_is_scheduled &&
@@ -158,13 +195,187 @@ static inline void prec_release(rsch_prec_t prec)
     __CLREX();
 }
 
+/** @brief Get time needed to meet all preconditions after they are requested.
+ *
+ * @returns  Ramp-up time of preconditions [us].
+ */
+static inline uint32_t prec_ramp_up_time_get(void)
+{
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+    if (m_hfclk_startup_samples < HFCLK_STARTUP_MIN_SAMPLES)
+    {
+        return PREC_RAMP_UP_TIME;
+    }
+
+    // Learned startup time covers HFCLK only.
+    return m_hfclk_startup_time + NRF_802154_HFCLK_STARTUP_MARGIN;
+#else // NRF_802154_HFCLK_PREWARM_ENABLED
+    return PREC_RAMP_UP_TIME;
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
+}
+
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+/** @brief Add measured HFCLK startup time to the histogram and update learned startup time.
+ *
+ * The learned startup time is the upper edge of the histogram bucket containing
+ * @ref NRF_802154_HFCLK_STARTUP_PERCENTILE percentile of samples, increased by one bucket to
+ * cover the resolution of the measurement. Until enough samples are gathered, the worst case
+ * ramp-up time is used.
+ *
+ * @param[in]  startup_time  Measured HFCLK startup time [us].
+ */
+static void hfclk_startup_sample_add(uint32_t startup_time)
+{
+    uint32_t bucket = startup_time / HFCLK_STARTUP_BUCKET_WIDTH;
+    uint32_t threshold;
+    uint32_t sum;
+    uint32_t i;
+
+    if (bucket >= HFCLK_STARTUP_BUCKETS_NUM)
+    {
+        bucket = HFCLK_STARTUP_BUCKETS_NUM - 1;
+    }
+
+    if (m_hfclk_startup_samples >= HFCLK_STARTUP_MAX_SAMPLES)
+    {
+        // Age the histogram to follow changes of the crystal startup time.
+        m_hfclk_startup_samples = 0;
+
+        for (i = 0; i < HFCLK_STARTUP_BUCKETS_NUM; i++)
+        {
+            m_hfclk_startup_hist[i] /= 2;
+            m_hfclk_startup_samples += m_hfclk_startup_hist[i];
+        }
+    }
+
+    m_hfclk_startup_hist[bucket]++;
+    m_hfclk_startup_samples++;
+
+    if (m_hfclk_startup_samples < HFCLK_STARTUP_MIN_SAMPLES)
+    {
+        return;
+    }
+
+    threshold = (m_hfclk_startup_samples * NRF_802154_HFCLK_STARTUP_PERCENTILE + 99) / 100;
+    sum       = 0;
+
+    for (i = 0; i < HFCLK_STARTUP_BUCKETS_NUM - 1; i++)
+    {
+        sum += m_hfclk_startup_hist[i];
+
+        if (sum >= threshold)
+        {
+            break;
+        }
+    }
+
+    m_hfclk_startup_time = (i + 2) * HFCLK_STARTUP_BUCKET_WIDTH;
+}
+
+/** @brief Take over HFCLK kept running after it was released.
+ *
+ * @retval true   HFCLK was lingering and the caller is now responsible for it.
+ * @retval false  HFCLK was not lingering.
+ */
+static inline bool hfclk_linger_take(void)
+{
+    do
+    {
+        uint8_t lingering = __LDREXB(&m_hfclk_is_lingering);
+
+        if (!lingering)
+        {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXB(0, &m_hfclk_is_lingering));
+
+    __DMB();
+
+    return true;
+}
+
+/** Timer callback used to stop HFCLK that was not requested again within the break-even time.
+ *
+ * @param[in]  p_context  Unused parameter.
+ */
+static void hfclk_linger_timeout(void * p_context)
+{
+    (void)p_context;
+
+    if (hfclk_linger_take())
+    {
+        nrf_802154_clock_hfclk_stop();
+    }
+}
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
+
+/** @brief Start HFCLK after the HFCLK precondition was requested.
+ *
+ * If HFCLK is still running after previous release, the precondition is approved immediately.
+ */
+static inline void hfclk_start(void)
+{
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+    if (hfclk_linger_take())
+    {
+        nrf_802154_timer_sched_remove(&m_hfclk_linger_timer);
+        prec_approve(RSCH_PREC_HFCLK);
+        return;
+    }
+
+    // Startup time cannot be measured if HFCLK is already running on behalf of another user.
+    m_hfclk_start_timestamp   = nrf_802154_timer_sched_time_get();
+    m_hfclk_start_is_measured = !nrf_802154_clock_hfclk_is_running();
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
+
+    nrf_802154_clock_hfclk_start();
+}
+
+/** @brief Release the HFCLK precondition and stop HFCLK.
+ *
+ * If break-even time is configured, HFCLK is kept running for that time in case it is
+ * requested again.
+ */
+static inline void hfclk_release(void)
+{
+#if NRF_802154_HFCLK_PREWARM_ENABLED && (NRF_802154_HFCLK_BREAK_EVEN_TIME > 0)
+    if (m_prec_states[RSCH_PREC_HFCLK] != RSCH_PREC_STATE_APPROVED)
+    {
+        // HFCLK is still starting up. It cannot be approved immediately on the next request.
+        m_hfclk_start_is_measured = false;
+
+        prec_release(RSCH_PREC_HFCLK);
+        nrf_802154_clock_hfclk_stop();
+        return;
+    }
+
+    // Mark HFCLK as lingering before the precondition is released, so that a request
+    // following the release takes over the running clock.
+    m_hfclk_is_lingering = 1;
+    __DMB();
+
+    prec_release(RSCH_PREC_HFCLK);
+
+    m_hfclk_linger_timer.t0        = nrf_802154_timer_sched_time_get();
+    m_hfclk_linger_timer.dt        = NRF_802154_HFCLK_BREAK_EVEN_TIME;
+    m_hfclk_linger_timer.callback  = hfclk_linger_timeout;
+    m_hfclk_linger_timer.p_context = NULL;
+
+    nrf_802154_timer_sched_add(&m_hfclk_linger_timer, true);
+#else // NRF_802154_HFCLK_PREWARM_ENABLED && (NRF_802154_HFCLK_BREAK_EVEN_TIME > 0)
+    prec_release(RSCH_PREC_HFCLK);
+    nrf_802154_clock_hfclk_stop();
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED && (NRF_802154_HFCLK_BREAK_EVEN_TIME > 0)
+}
+
 /** @brief Request all preconditions.
  */
 static inline void all_prec_request(void)
 {
     if (prec_request(RSCH_PREC_HFCLK))
     {
-        nrf_802154_clock_hfclk_start();
+        hfclk_start();
     }
 
     if (prec_request(RSCH_PREC_RAAL))
@@ -182,8 +393,7 @@ static inline void all_prec_release(void)
 {
     if (!m_in_cont_mode && !any_prec_should_be_requested_for_delayed_timeslot())
     {
-        prec_release(RSCH_PREC_HFCLK);
-        nrf_802154_clock_hfclk_stop();
+        hfclk_release();
 
         prec_release(RSCH_PREC_RAAL);
         nrf_raal_continuous_mode_exit();
@@ -278,6 +488,7 @@ static void delayed_timeslot_start(void * p_context)
 
     m_delayed_timeslot_is_scheduled = false;
 
+#if NRF_802154_DELAYED_TRX_ENABLED
     if (all_prec_are_approved())
     {
         nrf_802154_rsch_delayed_timeslot_started();
@@ -286,6 +497,10 @@ static void delayed_timeslot_start(void * p_context)
     {
         nrf_802154_rsch_delayed_timeslot_failed();
     }
+#else // NRF_802154_DELAYED_TRX_ENABLED
+    // Delayed timeslots are requested only by the delayed transmission feature.
+    assert(false);
+#endif // NRF_802154_DELAYED_TRX_ENABLED
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RSCH_TIMER_DELAYED_START);
 }
@@ -329,12 +544,33 @@ void nrf_802154_rsch_init(void)
     {
         m_prec_states[i] = RSCH_PREC_STATE_IDLE;
     }
+
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+    m_hfclk_startup_samples   = 0;
+    m_hfclk_startup_time      = PREC_RAMP_UP_TIME;
+    m_hfclk_start_is_measured = false;
+    m_hfclk_is_lingering      = 0;
+
+    for (uint32_t i = 0; i < HFCLK_STARTUP_BUCKETS_NUM; i++)
+    {
+        m_hfclk_startup_hist[i] = 0;
+    }
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
 }
 
 void nrf_802154_rsch_uninit(void)
 {
     nrf_802154_timer_sched_remove(&m_timer);
 
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+    nrf_802154_timer_sched_remove(&m_hfclk_linger_timer);
+
+    if (hfclk_linger_take())
+    {
+        nrf_802154_clock_hfclk_stop();
+    }
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
+
     nrf_raal_uninit();
 }
 
@@ -382,8 +618,9 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t t0, uint32_t dt, uint32_t
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RSCH_DELAYED_TIMESLOT_REQ);
 
-    uint32_t now    = nrf_802154_timer_sched_time_get();
-    uint32_t req_dt = dt - PREC_RAMP_UP_TIME;
+    uint32_t now     = nrf_802154_timer_sched_time_get();
+    uint32_t ramp_up = prec_ramp_up_time_get();
+    uint32_t req_dt  = dt - ramp_up;
     bool     result;
 
     assert(!nrf_802154_timer_sched_is_running(&m_timer));
@@ -394,6 +631,7 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t t0, uint32_t dt, uint32_t
         m_delayed_timeslot_is_scheduled = true;
         m_delayed_timeslot_t0           = t0;
         m_delayed_timeslot_dt           = dt;
+        m_delayed_timeslot_ramp_up_time = ramp_up;
 
         m_timer.t0        = t0;
         m_timer.dt        = req_dt;
@@ -409,6 +647,7 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t t0, uint32_t dt, uint32_t
         m_delayed_timeslot_is_scheduled = true;
         m_delayed_timeslot_t0           = t0;
         m_delayed_timeslot_dt           = dt;
+        m_delayed_timeslot_ramp_up_time = ramp_up;
 
         m_timer.t0        = t0;
         m_timer.dt        = dt;
@@ -460,6 +699,14 @@ void nrf_raal_timeslot_ended(void)
 
 void nrf_802154_clock_hfclk_ready(void)
 {
+#if NRF_802154_HFCLK_PREWARM_ENABLED
+    if (m_hfclk_start_is_measured)
+    {
+        m_hfclk_start_is_measured = false;
+        hfclk_startup_sample_add(nrf_802154_timer_sched_time_get() - m_hfclk_start_timestamp);
+    }
+#endif // NRF_802154_HFCLK_PREWARM_ENABLED
+
     prec_approve(RSCH_PREC_HFCLK);
 
     notify_core();
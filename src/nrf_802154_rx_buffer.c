@@ -39,23 +39,51 @@
 #include <stddef.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_utils.h"
 
-#if NRF_802154_RX_BUFFERS < 1
+#if (NRF_802154_RX_BUFFERS + RX_DONATED_BUFFERS) < 1
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
-rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
+#if NRF_802154_RX_BUFFERS > 0
+rx_buffer_t NRF_802154_PER_INSTANCE(nrf_802154_rx_buffers)[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
+#endif
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+/// Buffers donated by the higher layer. NULL marks an empty slot.
+static rx_buffer_t * volatile NRF_802154_PER_INSTANCE(mp_donated_buffers)[NRF_802154_RX_DONATED_BUFFERS];
+#define mp_donated_buffers NRF_802154_INSTANCE_OF(mp_donated_buffers)
+#endif
+
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+static rx_buffer_t NRF_802154_PER_INSTANCE(m_emergency_buffer); ///< Buffer reserved for MAC command frames.
+#define m_emergency_buffer NRF_802154_INSTANCE_OF(m_emergency_buffer)
+#endif
 
 void nrf_802154_rx_buffer_init(void)
 {
+#if NRF_802154_RX_BUFFERS > 0
     for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
     {
         nrf_802154_rx_buffers[i].free = true;
     }
+#endif
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+    for (uint32_t i = 0; i < NRF_802154_RX_DONATED_BUFFERS; i++)
+    {
+        mp_donated_buffers[i] = NULL;
+    }
+#endif
+
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+    m_emergency_buffer.free = true;
+#endif
 }
 
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
 {
+#if NRF_802154_RX_BUFFERS > 0
     for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
     {
         if (nrf_802154_rx_buffers[i].free)
@@ -63,6 +91,67 @@ rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
             return &nrf_802154_rx_buffers[i];
         }
     }
+#endif
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+    for (uint32_t i = 0; i < NRF_802154_RX_DONATED_BUFFERS; i++)
+    {
+        rx_buffer_t * p_buffer = mp_donated_buffers[i];
+
+        if ((p_buffer != NULL) && p_buffer->free)
+        {
+            return p_buffer;
+        }
+    }
+#endif
 
     return NULL;
 }
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+
+bool nrf_802154_rx_buffer_donated_add(rx_buffer_t * p_buffer)
+{
+    for (uint32_t i = 0; i < NRF_802154_RX_DONATED_BUFFERS; i++)
+    {
+        if (mp_donated_buffers[i] == NULL)
+        {
+            p_buffer->free = true;
+            __DMB();
+
+            mp_donated_buffers[i] = p_buffer;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void nrf_802154_rx_buffer_donated_release(const rx_buffer_t * p_buffer)
+{
+    for (uint32_t i = 0; i < NRF_802154_RX_DONATED_BUFFERS; i++)
+    {
+        if (mp_donated_buffers[i] == p_buffer)
+        {
+            mp_donated_buffers[i] = NULL;
+            break;
+        }
+    }
+}
+
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+
+rx_buffer_t * nrf_802154_rx_buffer_emergency_find(void)
+{
+    return m_emergency_buffer.free ? &m_emergency_buffer : NULL;
+}
+
+bool nrf_802154_rx_buffer_is_emergency(const rx_buffer_t * p_buffer)
+{
+    return p_buffer == &m_emergency_buffer;
+}
+
+#endif // NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
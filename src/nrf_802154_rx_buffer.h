@@ -39,12 +39,29 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+#define RX_DONATED_BUFFERS NRF_802154_RX_DONATED_BUFFERS ///< Number of slots for donated buffers.
+#else
+#define RX_DONATED_BUFFERS 0                             ///< Number of slots for donated buffers.
+#endif
+
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+#define RX_EMERGENCY_BUFFERS 1                           ///< Number of emergency buffers.
+#else
+#define RX_EMERGENCY_BUFFERS 0                           ///< Number of emergency buffers.
+#endif
+
+/// Maximal number of buffers that can contain received frames at the same time.
+#define RX_BUFFERS_TOTAL (NRF_802154_RX_BUFFERS + RX_DONATED_BUFFERS + RX_EMERGENCY_BUFFERS)
+
 /**
  * @brief Structure containing received frame.
  */
@@ -61,7 +78,8 @@ typedef struct
  * one buffer provided by this module.
  *
  */
-extern rx_buffer_t nrf_802154_rx_buffers[];
+extern rx_buffer_t NRF_802154_PER_INSTANCE(nrf_802154_rx_buffers)[NRF_802154_RX_BUFFERS];
+#define nrf_802154_rx_buffers NRF_802154_INSTANCE_OF(nrf_802154_rx_buffers)
 
 /**
  * @brief Initialize buffer for received frames.
@@ -75,6 +93,51 @@ void nrf_802154_rx_buffer_init(void);
  */
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
 
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+
+/**
+ * @brief Add a buffer donated by the higher layer to the pool of receive buffers.
+ *
+ * @param[in]  p_buffer  Pointer to the donated buffer.
+ *
+ * @retval true   The buffer was added to the pool.
+ * @retval false  There is no free slot for another donated buffer.
+ */
+bool nrf_802154_rx_buffer_donated_add(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Remove a donated buffer from the pool of receive buffers.
+ *
+ * This function is called when a frame received to the buffer is handed over to the higher layer.
+ * It has no effect if @p p_buffer is not a donated buffer.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer that is no longer owned by the driver.
+ */
+void nrf_802154_rx_buffer_donated_release(const rx_buffer_t * p_buffer);
+
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
+#if NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+
+/**
+ * @brief Get the emergency buffer used when all other buffers are in use.
+ *
+ * @return  Pointer to the emergency buffer or NULL if it contains a frame.
+ */
+rx_buffer_t * nrf_802154_rx_buffer_emergency_find(void);
+
+/**
+ * @brief Check if given buffer is the emergency buffer.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer to check.
+ *
+ * @retval true   @p p_buffer is the emergency buffer.
+ * @retval false  @p p_buffer is a regular receive buffer.
+ */
+bool nrf_802154_rx_buffer_is_emergency(const rx_buffer_t * p_buffer);
+
+#endif // NRF_802154_RX_OVERFLOW_POLICY == NRF_802154_RX_OVERFLOW_POLICY_EMERGENCY_BUFFER
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,15 +45,22 @@
 #include "nrf_802154_core.h"
 #include "nrf_802154_rsch.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_utils.h"
 #include "hal/nrf_egu.h"
 
 
-/** Size of notification queue.
+/** Size of priority notification queue.
  *
- * One slot for each receive buffer, one for transmission, one for busy channel and one for energy
- * detection.
+ * One slot for transmission, one for busy channel and one for energy detection results, and one
+ * slot to distinguish full queue from empty one.
  */
-#define NTF_QUEUE_SIZE (NRF_802154_RX_BUFFERS + 3)
+#define NTF_PRIO_QUEUE_SIZE 4
+/** Size of bulk notification queue.
+ *
+ * One slot for each receive buffer (including donated and emergency ones), one for reception
+ * failure, and one slot to distinguish full queue from empty one.
+ */
+#define NTF_BULK_QUEUE_SIZE (RX_BUFFERS_TOTAL + 2)
 /** Size of requests queue.
  *
  * Two is minimal queue size. It is not expected in current implementation to queue a few requests.
@@ -76,6 +83,10 @@
 #define REQ_TASK  NRF_EGU_TASK_TRIGGER2               ///< Label of request task.
 #define REQ_EVENT NRF_EGU_EVENT_TRIGGERED2            ///< Label of request event.
 
+#define BH_INT   NRF_EGU_INT_TRIGGERED3               ///< Label of RADIO IRQ bottom half interrupt.
+#define BH_TASK  NRF_EGU_TASK_TRIGGER3                ///< Label of RADIO IRQ bottom half task.
+#define BH_EVENT NRF_EGU_EVENT_TRIGGERED3             ///< Label of RADIO IRQ bottom half event.
+
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
 
@@ -90,6 +101,7 @@ typedef enum
     NTF_TYPE_ENERGY_DETECTION_FAILED,  ///< Energy detection procedure failed
     NTF_TYPE_CCA,                      ///< CCA procedure ended
     NTF_TYPE_CCA_FAILED,               ///< CCA procedure failed
+    NTF_TYPE_WITHDRAWN,                ///< Notification withdrawn before it was processed
 } nrf_802154_ntf_type_t;
 
 /// Notification data in the notification queue.
@@ -156,6 +168,8 @@ typedef enum
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
     REQ_TYPE_BUFFER_FREE,
+    REQ_TYPE_BUFFER_FREE_BATCH,
+    REQ_TYPE_BUFFER_DONATE,
     REQ_TYPE_CHANNEL_UPDATE,
     REQ_TYPE_CCA_CFG_UPDATE
 } nrf_802154_req_type_t;
@@ -217,6 +231,19 @@ typedef struct
             bool    * p_result;                          ///< Buffer free request result.
         } buffer_free;                                   ///< Buffer free request details.
 
+        struct
+        {
+            uint8_t * const * pp_data;                   ///< Array of pointers to receive buffers to free.
+            uint8_t           count;                     ///< Number of buffers to free.
+            bool            * p_result;                  ///< Buffers free request result.
+        } buffer_free_batch;                             ///< Batched buffers free request details.
+
+        struct
+        {
+            uint8_t * p_data;                            ///< Pointer to donated receive buffer.
+            bool    * p_result;                          ///< Buffer donate request result.
+        } buffer_donate;                                 ///< Buffer donate request details.
+
         struct
         {
             bool * p_result;                             ///< Channel update request result.
@@ -229,13 +256,31 @@ typedef struct
     } data;                                              ///< Request data depending on it's type.
 } nrf_802154_req_data_t;
 
-static nrf_802154_ntf_data_t m_ntf_queue[NTF_QUEUE_SIZE];  ///< Notification queue.
-static uint8_t               m_ntf_r_ptr;                  ///< Notification queue read index.
-static uint8_t               m_ntf_w_ptr;                  ///< Notification queue write index.
-
-static nrf_802154_req_data_t m_req_queue[REQ_QUEUE_SIZE];  ///< Request queue.
-static uint8_t               m_req_r_ptr;                  ///< Request queue read index.
-static uint8_t               m_req_w_ptr;                  ///< Request queue write index.
+/// Notification queue.
+typedef struct
+{
+    nrf_802154_ntf_data_t * p_slots;    ///< Slots of the queue.
+    uint8_t                 size;       ///< Number of slots in the queue.
+    uint8_t                 r_ptr;      ///< Read index.
+    uint8_t                 w_ptr;      ///< Write index.
+    uint8_t                 max_depth;  ///< Maximal number of notifications pending in the queue.
+} nrf_802154_ntf_queue_t;
+
+static nrf_802154_ntf_data_t  NRF_802154_PER_INSTANCE(m_ntf_prio_slots)[NTF_PRIO_QUEUE_SIZE]; ///< Slots of priority notification queue.
+static nrf_802154_ntf_data_t  NRF_802154_PER_INSTANCE(m_ntf_bulk_slots)[NTF_BULK_QUEUE_SIZE]; ///< Slots of bulk notification queue.
+static nrf_802154_ntf_queue_t NRF_802154_PER_INSTANCE(m_ntf_prio_queue);                      ///< Queue of transmission, CCA and energy detection results.
+static nrf_802154_ntf_queue_t NRF_802154_PER_INSTANCE(m_ntf_bulk_queue);                      ///< Queue of reception notifications.
+#define m_ntf_prio_slots NRF_802154_INSTANCE_OF(m_ntf_prio_slots)
+#define m_ntf_bulk_slots NRF_802154_INSTANCE_OF(m_ntf_bulk_slots)
+#define m_ntf_prio_queue NRF_802154_INSTANCE_OF(m_ntf_prio_queue)
+#define m_ntf_bulk_queue NRF_802154_INSTANCE_OF(m_ntf_bulk_queue)
+
+static nrf_802154_req_data_t NRF_802154_PER_INSTANCE(m_req_queue)[REQ_QUEUE_SIZE]; ///< Request queue.
+static uint8_t               NRF_802154_PER_INSTANCE(m_req_r_ptr);                 ///< Request queue read index.
+static uint8_t               NRF_802154_PER_INSTANCE(m_req_w_ptr);                 ///< Request queue write index.
+#define m_req_queue NRF_802154_INSTANCE_OF(m_req_queue)
+#define m_req_r_ptr NRF_802154_INSTANCE_OF(m_req_r_ptr)
+#define m_req_w_ptr NRF_802154_INSTANCE_OF(m_req_w_ptr)
 
 /**
  * Increment given index for any queue.
@@ -291,35 +336,61 @@ static bool queue_is_empty(uint8_t r_ptr, uint8_t w_ptr)
 }
 
 /**
- * Increment given index associated with notification queue.
+ * Initialize given notification queue.
  *
- * @param[inout]  p_ptr  Pointer to the index to increment.
+ * @param[out]  p_queue  Pointer to the notification queue.
+ * @param[in]   p_slots  Slots of the notification queue.
+ * @param[in]   size     Number of slots in the notification queue.
  */
-static void ntf_queue_ptr_increment(uint8_t * p_ptr)
+static void ntf_queue_init(nrf_802154_ntf_queue_t * p_queue,
+                           nrf_802154_ntf_data_t  * p_slots,
+                           uint8_t                  size)
 {
-    queue_ptr_increment(p_ptr, NTF_QUEUE_SIZE);
+    p_queue->p_slots   = p_slots;
+    p_queue->size      = size;
+    p_queue->r_ptr     = 0;
+    p_queue->w_ptr     = 0;
+    p_queue->max_depth = 0;
 }
 
 /**
- * Check if notification queue is full.
+ * Check if given notification queue is full.
+ *
+ * @param[in]  p_queue  Pointer to the notification queue.
  *
  * @retval  true   Notification queue is full.
  * @retval  false  Notification queue is not full.
  */
-static bool ntf_queue_is_full(void)
+static bool ntf_queue_is_full(const nrf_802154_ntf_queue_t * p_queue)
 {
-    return queue_is_full(m_ntf_r_ptr, m_ntf_w_ptr, NTF_QUEUE_SIZE);
+    return queue_is_full(p_queue->r_ptr, p_queue->w_ptr, p_queue->size);
 }
 
 /**
- * Check if notification queue is empty.
+ * Check if given notification queue is empty.
+ *
+ * @param[in]  p_queue  Pointer to the notification queue.
  *
  * @retval  true   Notification queue is empty.
  * @retval  false  Notification queue is not empty.
  */
-static bool ntf_queue_is_empty(void)
+static bool ntf_queue_is_empty(const nrf_802154_ntf_queue_t * p_queue)
 {
-    return queue_is_empty(m_ntf_r_ptr, m_ntf_w_ptr);
+    return queue_is_empty(p_queue->r_ptr, p_queue->w_ptr);
+}
+
+/**
+ * Get number of notifications pending in given notification queue.
+ *
+ * @param[in]  p_queue  Pointer to the notification queue.
+ *
+ * @return Number of pending notifications.
+ */
+static uint8_t ntf_queue_depth_get(const nrf_802154_ntf_queue_t * p_queue)
+{
+    return (p_queue->w_ptr >= p_queue->r_ptr) ?
+           (p_queue->w_ptr - p_queue->r_ptr) :
+           (p_queue->size - p_queue->r_ptr + p_queue->w_ptr);
 }
 
 /**
@@ -328,18 +399,20 @@ static bool ntf_queue_is_empty(void)
  * This is a helper function used in all notification functions to atomically
  * find an empty slot in the notification queue and allow atomic slot update.
  *
+ * @param[in]  p_queue  Pointer to the notification queue.
+ *
  * @return Pointer to an empty slot in the notification queue.
  */
-static nrf_802154_ntf_data_t * ntf_enter(void)
+static nrf_802154_ntf_data_t * ntf_enter(nrf_802154_ntf_queue_t * p_queue)
 {
     __disable_irq();
     __DSB();
     __ISB();
 
-    assert(!ntf_queue_is_full());
-    (void)ntf_queue_is_full();
+    assert(!ntf_queue_is_full(p_queue));
+    (void)ntf_queue_is_full(p_queue);
 
-    return &m_ntf_queue[m_ntf_w_ptr];
+    return &p_queue->p_slots[p_queue->w_ptr];
 }
 
 /**
@@ -347,10 +420,21 @@ static nrf_802154_ntf_data_t * ntf_enter(void)
  *
  * This is a helper function used in all notification functions to end atomic slot update
  * and trigger SWI to process the notification from the slot.
+ *
+ * @param[in]  p_queue  Pointer to the notification queue.
  */
-static void ntf_exit(void)
+static void ntf_exit(nrf_802154_ntf_queue_t * p_queue)
 {
-    ntf_queue_ptr_increment(&m_ntf_w_ptr);
+    uint8_t depth;
+
+    queue_ptr_increment(&p_queue->w_ptr, p_queue->size);
+
+    depth = ntf_queue_depth_get(p_queue);
+
+    if (depth > p_queue->max_depth)
+    {
+        p_queue->max_depth = depth;
+    }
 
     nrf_egu_task_trigger(SWI_EGU, NTF_TASK);
 
@@ -428,10 +512,13 @@ static void req_exit(void)
 
 void nrf_802154_swi_init(void)
 {
-    m_ntf_r_ptr = 0;
-    m_ntf_w_ptr = 0;
+    ntf_queue_init(&m_ntf_prio_queue, m_ntf_prio_slots, NTF_PRIO_QUEUE_SIZE);
+    ntf_queue_init(&m_ntf_bulk_queue, m_ntf_bulk_slots, NTF_BULK_QUEUE_SIZE);
 
     nrf_egu_int_enable(SWI_EGU, NTF_INT | TIMESLOT_EXIT_INT |  REQ_INT);
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+    nrf_egu_int_enable(SWI_EGU, BH_INT);
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
 
     NVIC_SetPriority(SWI_IRQn, NRF_802154_SWI_PRIORITY);
     NVIC_ClearPendingIRQ(SWI_IRQn);
@@ -440,24 +527,58 @@ void nrf_802154_swi_init(void)
 
 void nrf_802154_swi_notify_received(uint8_t * p_data, int8_t power, int8_t lqi)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_bulk_queue);
 
     p_slot->type                 = NTF_TYPE_RECEIVED;
     p_slot->data.received.p_psdu = p_data;
     p_slot->data.received.power  = power;
     p_slot->data.received.lqi    = lqi;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_bulk_queue);
+}
+
+uint8_t * nrf_802154_swi_notify_received_withdraw(nrf_802154_notification_received_filter_t filter)
+{
+    nrf_802154_ntf_queue_t * p_queue = &m_ntf_bulk_queue;
+    uint8_t                * p_data  = NULL;
+    uint8_t                  ptr;
+
+    __disable_irq();
+    __DSB();
+    __ISB();
+
+    if (!ntf_queue_is_empty(p_queue))
+    {
+        // Skip the oldest notification as SWI handler may be processing it now.
+        ptr = p_queue->r_ptr;
+        queue_ptr_increment(&ptr, p_queue->size);
+
+        for (; ptr != p_queue->w_ptr; queue_ptr_increment(&ptr, p_queue->size))
+        {
+            nrf_802154_ntf_data_t * p_slot = &p_queue->p_slots[ptr];
+
+            if ((p_slot->type == NTF_TYPE_RECEIVED) && filter(p_slot->data.received.p_psdu))
+            {
+                p_slot->type = NTF_TYPE_WITHDRAWN;
+                p_data       = p_slot->data.received.p_psdu;
+                break;
+            }
+        }
+    }
+
+    __enable_irq();
+
+    return p_data;
 }
 
 void nrf_802154_swi_notify_receive_failed(nrf_802154_rx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_bulk_queue);
 
     p_slot->type                      = NTF_TYPE_RECEIVE_FAILED;
     p_slot->data.receive_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_bulk_queue);
 }
 
 void nrf_802154_swi_notify_transmitted(const uint8_t * p_frame,
@@ -465,7 +586,7 @@ void nrf_802154_swi_notify_transmitted(const uint8_t * p_frame,
                                        int8_t          power,
                                        int8_t          lqi)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_prio_queue);
 
     p_slot->type                     = NTF_TYPE_TRANSMITTED;
     p_slot->data.transmitted.p_frame = p_frame;
@@ -473,58 +594,66 @@ void nrf_802154_swi_notify_transmitted(const uint8_t * p_frame,
     p_slot->data.transmitted.power   = power;
     p_slot->data.transmitted.lqi     = lqi;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_prio_queue);
 }
 
 void nrf_802154_swi_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_prio_queue);
 
     p_slot->type                         = NTF_TYPE_TRANSMIT_FAILED;
     p_slot->data.transmit_failed.p_frame = p_frame;
     p_slot->data.transmit_failed.error   = error;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_prio_queue);
 }
 
 void nrf_802154_swi_notify_energy_detected(uint8_t result)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_prio_queue);
 
     p_slot->type                        = NTF_TYPE_ENERGY_DETECTED;
     p_slot->data.energy_detected.result = result;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_prio_queue);
 }
 
 void nrf_802154_swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_prio_queue);
 
     p_slot->type                               = NTF_TYPE_ENERGY_DETECTION_FAILED;
     p_slot->data.energy_detection_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_prio_queue);
 }
 
 void nrf_802154_swi_notify_cca(bool channel_free)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_prio_queue);
 
     p_slot->type            = NTF_TYPE_CCA;
     p_slot->data.cca.result = channel_free;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_prio_queue);
 }
 
 void nrf_802154_swi_notify_cca_failed(nrf_802154_cca_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(&m_ntf_prio_queue);
 
     p_slot->type                  = NTF_TYPE_CCA_FAILED;
     p_slot->data.cca_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(&m_ntf_prio_queue);
+}
+
+void nrf_802154_swi_ntf_stats_get(nrf_802154_swi_ntf_stats_t * p_stats)
+{
+    assert(p_stats != NULL);
+
+    p_stats->prio_max_depth = m_ntf_prio_queue.max_depth;
+    p_stats->bulk_max_depth = m_ntf_bulk_queue.max_depth;
 }
 
 void nrf_802154_swi_timeslot_exit(void)
@@ -539,6 +668,11 @@ void nrf_802154_swi_timeslot_exit_terminate(void)
     nrf_egu_event_clear(SWI_EGU, TIMESLOT_EXIT_EVENT);
 }
 
+void nrf_802154_swi_irq_bottom_half_trigger(void)
+{
+    nrf_egu_task_trigger(SWI_EGU, BH_TASK);
+}
+
 void nrf_802154_swi_sleep(nrf_802154_term_t term_lvl, bool * p_result)
 {
     nrf_802154_req_data_t * p_slot = req_enter();
@@ -637,6 +771,31 @@ void nrf_802154_swi_buffer_free(uint8_t * p_data, bool * p_result)
     req_exit();
 }
 
+void nrf_802154_swi_buffer_free_batch(uint8_t * const * pp_data, uint8_t count, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                            = REQ_TYPE_BUFFER_FREE_BATCH;
+    p_slot->data.buffer_free_batch.pp_data  = pp_data;
+    p_slot->data.buffer_free_batch.count    = count;
+    p_slot->data.buffer_free_batch.p_result = p_result;
+
+    req_exit();
+}
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+void nrf_802154_swi_buffer_donate(uint8_t * p_data, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                        = REQ_TYPE_BUFFER_DONATE;
+    p_slot->data.buffer_donate.p_data   = p_data;
+    p_slot->data.buffer_donate.p_result = p_result;
+
+    req_exit();
+}
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
 void nrf_802154_swi_channel_update(bool * p_result)
 {
     nrf_802154_req_data_t * p_slot = req_enter();
@@ -657,83 +816,130 @@ void nrf_802154_swi_cca_cfg_update(bool * p_result)
     req_exit();
 }
 
-void SWI_IRQHandler(void)
+/**
+ * Process given notification.
+ *
+ * @param[in]  p_slot  Pointer to the notification slot.
+ */
+static void ntf_process(const nrf_802154_ntf_data_t * p_slot)
 {
-    if (nrf_egu_event_check(SWI_EGU, NTF_EVENT))
+    switch (p_slot->type)
     {
-        nrf_egu_event_clear(SWI_EGU, NTF_EVENT);
-
-        while (!ntf_queue_is_empty())
-        {
-            nrf_802154_ntf_data_t * p_slot = &m_ntf_queue[m_ntf_r_ptr];
-
-            switch (p_slot->type)
-            {
-                case NTF_TYPE_RECEIVED:
+        case NTF_TYPE_RECEIVED:
 #if NRF_802154_USE_RAW_API
-                    nrf_802154_received_raw(p_slot->data.received.p_psdu,
-                                            p_slot->data.received.power,
-                                            p_slot->data.received.lqi);
+            nrf_802154_received_raw(p_slot->data.received.p_psdu,
+                                    p_slot->data.received.power,
+                                    p_slot->data.received.lqi);
 #else // NRF_802154_USE_RAW_API
-                    nrf_802154_received(p_slot->data.received.p_psdu + RAW_PAYLOAD_OFFSET,
-                                        p_slot->data.received.p_psdu[RAW_LENGTH_OFFSET],
-                                        p_slot->data.received.power,
-                                        p_slot->data.received.lqi);
+            nrf_802154_received(p_slot->data.received.p_psdu + RAW_PAYLOAD_OFFSET,
+                                p_slot->data.received.p_psdu[RAW_LENGTH_OFFSET],
+                                p_slot->data.received.power,
+                                p_slot->data.received.lqi);
 #endif
-                    break;
+            break;
 
-                case NTF_TYPE_RECEIVE_FAILED:
-                    nrf_802154_receive_failed(p_slot->data.receive_failed.error);
-                    break;
+        case NTF_TYPE_RECEIVE_FAILED:
+            nrf_802154_receive_failed(p_slot->data.receive_failed.error);
+            break;
 
-                case NTF_TYPE_TRANSMITTED:
+        case NTF_TYPE_TRANSMITTED:
 #if NRF_802154_USE_RAW_API
-                    nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
-                                               p_slot->data.transmitted.p_psdu,
-                                               p_slot->data.transmitted.power,
-                                               p_slot->data.transmitted.lqi);
+            nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
+                                       p_slot->data.transmitted.p_psdu,
+                                       p_slot->data.transmitted.power,
+                                       p_slot->data.transmitted.lqi);
 #else // NRF_802154_USE_RAW_API
-                    nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
-                                           p_slot->data.transmitted.p_psdu == NULL ? NULL :
-                                               p_slot->data.transmitted.p_psdu + RAW_PAYLOAD_OFFSET,
-                                           p_slot->data.transmitted.p_psdu[RAW_LENGTH_OFFSET],
-                                           p_slot->data.transmitted.power,
-                                           p_slot->data.transmitted.lqi);
+            nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
+                                   p_slot->data.transmitted.p_psdu == NULL ? NULL :
+                                       p_slot->data.transmitted.p_psdu + RAW_PAYLOAD_OFFSET,
+                                   p_slot->data.transmitted.p_psdu[RAW_LENGTH_OFFSET],
+                                   p_slot->data.transmitted.power,
+                                   p_slot->data.transmitted.lqi);
 #endif
-                    break;
+            break;
 
-                case NTF_TYPE_TRANSMIT_FAILED:
+        case NTF_TYPE_TRANSMIT_FAILED:
 #if NRF_802154_USE_RAW_API
-                    nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
-                                               p_slot->data.transmit_failed.error);
+            nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
+                                       p_slot->data.transmit_failed.error);
 #else // NRF_802154_USE_RAW_API
-                    nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
-                                               p_slot->data.transmit_failed.error);
+            nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
+                                       p_slot->data.transmit_failed.error);
 #endif
-                    break;
+            break;
 
-                case NTF_TYPE_ENERGY_DETECTED:
-                    nrf_802154_energy_detected(p_slot->data.energy_detected.result);
-                    break;
+        case NTF_TYPE_ENERGY_DETECTED:
+            nrf_802154_energy_detected(p_slot->data.energy_detected.result);
+            break;
 
-                case NTF_TYPE_ENERGY_DETECTION_FAILED:
-                    nrf_802154_energy_detection_failed(
-                            p_slot->data.energy_detection_failed.error);
-                    break;
+        case NTF_TYPE_ENERGY_DETECTION_FAILED:
+            nrf_802154_energy_detection_failed(
+                    p_slot->data.energy_detection_failed.error);
+            break;
 
-                case NTF_TYPE_CCA:
-                    nrf_802154_cca_done(p_slot->data.cca.result);
-                    break;
+        case NTF_TYPE_CCA:
+            nrf_802154_cca_done(p_slot->data.cca.result);
+            break;
 
-                case NTF_TYPE_CCA_FAILED:
-                    nrf_802154_cca_failed(p_slot->data.cca_failed.error);
-                    break;
+        case NTF_TYPE_CCA_FAILED:
+            nrf_802154_cca_failed(p_slot->data.cca_failed.error);
+            break;
 
-                default:
-                    assert(false);
-            }
+        case NTF_TYPE_WITHDRAWN:
+            // Frame was dropped by the Core module. Nothing to notify.
+            break;
+
+        default:
+            assert(false);
+    }
+}
+
+/**
+ * Get next notification to process.
+ *
+ * Notifications from the priority queue are processed before any pending reception
+ * notification.
+ *
+ * @return Pointer to the queue holding next notification or NULL if there is no notification.
+ */
+static nrf_802154_ntf_queue_t * ntf_next_queue_get(void)
+{
+    if (!ntf_queue_is_empty(&m_ntf_prio_queue))
+    {
+        return &m_ntf_prio_queue;
+    }
+
+    if (!ntf_queue_is_empty(&m_ntf_bulk_queue))
+    {
+        return &m_ntf_bulk_queue;
+    }
 
-            ntf_queue_ptr_increment(&m_ntf_r_ptr);
+    return NULL;
+}
+
+void SWI_IRQHandler(void)
+{
+#if NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+    // Bottom half produces notifications. Process it first to deliver them in this call.
+    if (nrf_egu_event_check(SWI_EGU, BH_EVENT))
+    {
+        nrf_egu_event_clear(SWI_EGU, BH_EVENT);
+
+        nrf_802154_core_irq_bottom_half();
+    }
+#endif // NRF_802154_IRQ_BOTTOM_HALF_ENABLED
+
+    if (nrf_egu_event_check(SWI_EGU, NTF_EVENT))
+    {
+        nrf_802154_ntf_queue_t * p_queue;
+
+        nrf_egu_event_clear(SWI_EGU, NTF_EVENT);
+
+        while ((p_queue = ntf_next_queue_get()) != NULL)
+        {
+            ntf_process(&p_queue->p_slots[p_queue->r_ptr]);
+
+            queue_ptr_increment(&p_queue->r_ptr, p_queue->size);
         }
     }
 
@@ -799,6 +1005,20 @@ void SWI_IRQHandler(void)
                             nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
                     break;
 
+                case REQ_TYPE_BUFFER_FREE_BATCH:
+                    *(p_slot->data.buffer_free_batch.p_result) =
+                            nrf_802154_core_notify_buffer_free_batch(
+                                    p_slot->data.buffer_free_batch.pp_data,
+                                    p_slot->data.buffer_free_batch.count);
+                    break;
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+                case REQ_TYPE_BUFFER_DONATE:
+                    *(p_slot->data.buffer_donate.p_result) =
+                            nrf_802154_core_notify_buffer_donated(p_slot->data.buffer_donate.p_data);
+                    break;
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
                 case REQ_TYPE_CHANNEL_UPDATE:
                     *(p_slot->data.channel_update.p_result) = nrf_802154_core_channel_update();
                     break;
@@ -49,6 +49,18 @@ extern "C" {
  * @brief SWI manager for 802.15.4 driver.
  */
 
+/**
+ * @brief Statistics of the notification queues.
+ *
+ * Results of transmission, CCA and energy detection are notified through the priority queue,
+ * which is always processed before the bulk queue of reception notifications.
+ */
+typedef struct
+{
+    uint8_t prio_max_depth;  ///< Maximal number of notifications pending in the priority queue.
+    uint8_t bulk_max_depth;  ///< Maximal number of notifications pending in the bulk queue.
+} nrf_802154_swi_ntf_stats_t;
+
 /**
  * @brief Initialize SWI module.
  */
@@ -63,6 +75,18 @@ void nrf_802154_swi_init(void);
  */
 void nrf_802154_swi_notify_received(uint8_t * p_data, int8_t power, int8_t lqi);
 
+/**
+ * @brief Withdraw the oldest pending notification about a received frame accepted by @p filter.
+ *
+ * The oldest pending notification is never withdrawn because it may be being processed by
+ * the preempted SWI handler.
+ *
+ * @param[in]  filter  Function selecting frames which notifications can be withdrawn.
+ *
+ * @return  Pointer to PSDU of the withdrawn frame or NULL if there is no such notification.
+ */
+uint8_t * nrf_802154_swi_notify_received_withdraw(nrf_802154_notification_received_filter_t filter);
+
 /**
  * @brief Notify next higher layer that reception of a frame failed.
  *
@@ -120,6 +144,13 @@ void nrf_802154_swi_notify_cca(bool channel_free);
  */
 void nrf_802154_swi_notify_cca_failed(nrf_802154_cca_error_t error);
 
+/**
+ * @brief Get statistics of the notification queues.
+ *
+ * @param[out]  p_stats  Pointer to the structure filled with the statistics.
+ */
+void nrf_802154_swi_ntf_stats_get(nrf_802154_swi_ntf_stats_t * p_stats);
+
 /**
  * @brief Request discarding of the timeslot from SWI priority level.
  *
@@ -134,6 +165,13 @@ void nrf_802154_swi_timeslot_exit(void);
  */
 void nrf_802154_swi_timeslot_exit_terminate(void);
 
+/**
+ * @brief Trigger processing of the RADIO IRQ bottom half at SWI priority level.
+ *
+ * @sa nrf_802154_core_irq_bottom_half
+ */
+void nrf_802154_swi_irq_bottom_half_trigger(void);
+
 /**
  * @brief Request entering sleep state from SWI priority.
  *
@@ -213,6 +251,25 @@ void nrf_802154_swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_resu
  */
 void nrf_802154_swi_buffer_free(uint8_t * p_data, bool * p_result);
 
+/**
+ * @brief Notify Core module that given buffers are not used anymore and can be freed.
+ *
+ * @param[in]   pp_data   Array of pointers to the buffers to free.
+ * @param[in]   count     Number of elements in @p pp_data.
+ * @param[out]  p_result  Result of the request.
+ */
+void nrf_802154_swi_buffer_free_batch(uint8_t * const * pp_data, uint8_t count, bool * p_result);
+
+#if NRF_802154_RX_BUFFER_DONATION_ENABLED
+/**
+ * @brief Notify Core module that the next higher layer donated a buffer to receive a frame to.
+ *
+ * @param[in]   p_data    Pointer to the donated buffer.
+ * @param[out]  p_result  Result of the request.
+ */
+void nrf_802154_swi_buffer_donate(uint8_t * p_data, bool * p_result);
+#endif // NRF_802154_RX_BUFFER_DONATION_ENABLED
+
 /**
  * @brief Notify Core module that the next higher layer requested channel change.
  */
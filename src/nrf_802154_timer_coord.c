@@ -41,6 +41,7 @@
 #include <stdint.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_utils.h"
 #include "hal/nrf_ppi.h"
 #include "platform/hp_timer/nrf_802154_hp_timer.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
@@ -71,10 +72,16 @@ typedef struct
     uint32_t hp_timer_time; ///< HP Timer time of common timepoint.
 } common_timepoint_t;
 
-static common_timepoint_t m_last_sync;    ///< Common timepoint of last synchronization event.
-static volatile bool      m_synchronized; ///< If timers were synchronized since last start.
-static bool               m_drift_known;  ///< If timer drift value is known.
-static int32_t            m_drift;        ///< Drift of the HP timer relatively to the LP timer [PPTB].
+static common_timepoint_t NRF_802154_PER_INSTANCE(m_last_sync);    ///< Common timepoint of last synchronization event.
+static volatile bool      NRF_802154_PER_INSTANCE(m_synchronized); ///< If timers were synchronized since last start.
+static volatile bool      NRF_802154_PER_INSTANCE(m_running);      ///< If HP timer is running.
+static bool               NRF_802154_PER_INSTANCE(m_drift_known);  ///< If timer drift value is known.
+static int32_t            NRF_802154_PER_INSTANCE(m_drift);        ///< Drift of the HP timer relatively to the LP timer [PPTB].
+#define m_last_sync    NRF_802154_INSTANCE_OF(m_last_sync)
+#define m_synchronized NRF_802154_INSTANCE_OF(m_synchronized)
+#define m_running      NRF_802154_INSTANCE_OF(m_running)
+#define m_drift_known  NRF_802154_INSTANCE_OF(m_drift_known)
+#define m_drift        NRF_802154_INSTANCE_OF(m_drift)
 
 void nrf_802154_timer_coord_init(void)
 {
@@ -109,6 +116,7 @@ void nrf_802154_timer_coord_uninit(void)
 void nrf_802154_timer_coord_start(void)
 {
     m_synchronized = false;
+    m_running      = true;
     nrf_802154_hp_timer_start();
     nrf_802154_hp_timer_sync_prepare();
     nrf_802154_lp_timer_sync_start_now();
@@ -116,6 +124,7 @@ void nrf_802154_timer_coord_start(void)
 
 void nrf_802154_timer_coord_stop(void)
 {
+    m_running = false;
     nrf_802154_hp_timer_stop();
     nrf_802154_lp_timer_sync_stop();
 }
@@ -152,6 +161,25 @@ bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
     return true;
 }
 
+bool nrf_802154_timer_coord_hp_time_get(uint32_t lp_time, uint32_t * p_hp_time)
+{
+    int32_t lp_delta;
+    int32_t drift;
+
+    assert(p_hp_time != NULL);
+
+    if (!m_running || !m_synchronized)
+    {
+        return false;
+    }
+
+    lp_delta   = (int32_t)(lp_time - m_last_sync.lp_timer_time);
+    drift      = m_drift_known ? (DIV_ROUND(((int64_t)m_drift * lp_delta), (int64_t)TIME_BASE)) : 0;
+    *p_hp_time = m_last_sync.hp_timer_time + lp_delta + drift;
+
+    return true;
+}
+
 void nrf_802154_lp_timer_synchronized(void)
 {
     common_timepoint_t sync_time;
@@ -246,4 +274,14 @@ bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
     return false;
 }
 
+bool nrf_802154_timer_coord_hp_time_get(uint32_t lp_time, uint32_t * p_hp_time)
+{
+    (void)lp_time;
+    (void)p_hp_time;
+
+    // Intentionally empty
+
+    return false;
+}
+
 #endif // NRF_802154_FRAME_TIMESTAMP_ENABLED
@@ -104,6 +104,19 @@ void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr);
  */
 bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp);
 
+/**
+ * @brief Convert absolute time to the HP timer time.
+ *
+ * If HP timer is not running or not synchronized, this function returns false.
+ *
+ * @param[in]   lp_time    Absolute time to convert [us].
+ * @param[out]  p_hp_time  HP timer value corresponding to @p lp_time [us].
+ *
+ * @retval true   Conversion succeeded.
+ * @retval false  Conversion failed, @p p_hp_time was not modified.
+ */
+bool nrf_802154_timer_coord_hp_time_get(uint32_t lp_time, uint32_t * p_hp_time);
+
 /**
  *@}
  **/
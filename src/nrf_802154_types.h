@@ -31,6 +31,7 @@
 #ifndef NRF_802154_TYPES_H__
 #define NRF_802154_TYPES_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "hal/nrf_radio.h"
@@ -68,6 +69,8 @@ typedef uint8_t nrf_802154_tx_error_t;
 #define NRF_802154_TX_ERROR_NO_ACK            0x05 //!< ACK frame was not received during time-out period.
 #define NRF_802154_TX_ERROR_ABORTED           0x06 //!< Procedure was aborted by another driver operation with FORCE priority.
 #define NRF_802154_TX_ERROR_TIMESLOT_DENIED   0x07 //!< Transmission did not start due to denied timeslot request.
+#define NRF_802154_TX_ERROR_DEADLINE          0x08 //!< Transmission could not finish before its deadline.
+#define NRF_802154_TX_ERROR_COEX_DENIED       0x09 //!< Co-located radio denied the medium for the transmission.
 
 /**
  * @brief Possible errors during frame reception.
@@ -126,6 +129,101 @@ typedef struct
     uint8_t              corr_limit;     //!< Limit of occurrences above CCA correlator busy threshold. Not used in NRF_RADIO_CCA_MODE_ED.
 } nrf_802154_cca_cfg_t;
 
+/**
+ * @brief Structure describing a fragment of a frame to transmit.
+ */
+typedef struct
+{
+    const uint8_t * p_data; //!< Pointer to the fragment.
+    uint8_t         length; //!< Length of the fragment in bytes.
+} nrf_802154_iovec_t;
+
+/**
+ * @brief Transmission parameters overridden by a transmit descriptor.
+ *
+ * Parameters that are not overridden are taken from the driver configuration.
+ */
+typedef uint8_t nrf_802154_tx_desc_flags_t;
+
+#define NRF_802154_TX_DESC_POWER       0x01  //!< Descriptor overrides transmit power.
+#define NRF_802154_TX_DESC_CHANNEL     0x02  //!< Descriptor overrides channel.
+#define NRF_802154_TX_DESC_CCA_CFG     0x04  //!< Descriptor overrides CCA configuration.
+#define NRF_802154_TX_DESC_CSMA_CA     0x08  //!< Frame is transmitted using CSMA-CA with parameters from the descriptor.
+#define NRF_802154_TX_DESC_ACK_TIMEOUT 0x10  //!< Descriptor overrides ACK time-out.
+#define NRF_802154_TX_DESC_DEADLINE    0x20  //!< Frame is dropped if it cannot be transmitted before the deadline from the descriptor.
+
+/**
+ * @brief Structure describing a single transmission with its own radio parameters.
+ */
+typedef struct
+{
+    const uint8_t            * p_data;         //!< Pointer to the frame to transmit. Format depends on NRF_802154_USE_RAW_API.
+    uint8_t                    length;         //!< Length of the frame without PHR and FCS. Not used with NRF_802154_USE_RAW_API.
+    bool                       cca;            //!< If CCA should be performed before transmission. Not used with NRF_802154_TX_DESC_CSMA_CA.
+    nrf_802154_tx_desc_flags_t flags;          //!< Parameters overridden by this descriptor.
+    int8_t                     tx_power;       //!< Transmit power in dBm. Used with NRF_802154_TX_DESC_POWER.
+    uint8_t                    channel;        //!< Channel number (11-26). Used with NRF_802154_TX_DESC_CHANNEL.
+    nrf_802154_cca_cfg_t       cca_cfg;        //!< CCA configuration. Used with NRF_802154_TX_DESC_CCA_CFG.
+    uint8_t                    min_be;         //!< Minimal CSMA-CA backoff exponent. Used with NRF_802154_TX_DESC_CSMA_CA.
+    uint8_t                    max_be;         //!< Maximal CSMA-CA backoff exponent. Used with NRF_802154_TX_DESC_CSMA_CA.
+    uint8_t                    max_backoffs;   //!< Maximal number of CSMA-CA backoffs. Used with NRF_802154_TX_DESC_CSMA_CA.
+    uint32_t                   ack_timeout;    //!< ACK time-out in us. Used with NRF_802154_TX_DESC_ACK_TIMEOUT.
+    uint32_t                   deadline;       //!< Absolute time used by the Timer Scheduler [us] by which the transmission procedure shall end. Used with NRF_802154_TX_DESC_DEADLINE.
+    void                     * p_context;      //!< User context returned by @ref nrf_802154_transmit_ex_desc_get.
+} nrf_802154_tx_desc_t;
+
+/**
+ * @brief Statistics of automatic transmit power control for a neighbor.
+ */
+typedef struct
+{
+    uint32_t tx_count;         //!< Number of frames requesting ACK transmitted to the neighbor.
+    uint32_t ack_count;        //!< Number of these frames that were acknowledged.
+    uint32_t no_ack_count;     //!< Number of these frames that were not acknowledged.
+    uint32_t power_saved_sum;  //!< Sum of transmit power reductions of all transmitted frames [dB].
+    int8_t   tx_power;         //!< Transmit power currently used for the neighbor [dBm].
+} nrf_802154_tx_power_stats_t;
+
+/**
+ * @brief Statistics of receive buffer overflows.
+ */
+typedef struct
+{
+    uint32_t no_buffer;          //!< Number of times the receiver ran out of regular receive buffers.
+    uint32_t emergency_rejected; //!< Number of frames dropped because only the emergency buffer was available.
+    uint32_t broadcast_dropped;  //!< Number of undelivered broadcast frames dropped to make room.
+} nrf_802154_rx_overflow_stats_t;
+
+/**
+ * @brief Antennas selected by the antenna diversity feature.
+ */
+typedef uint8_t nrf_802154_ant_div_antenna_t;
+
+#define NRF_802154_ANT_DIV_ANTENNA_1 0x00 //!< Antenna selected by the low level of the antenna select pin.
+#define NRF_802154_ANT_DIV_ANTENNA_2 0x01 //!< Antenna selected by the high level of the antenna select pin.
+#define NRF_802154_ANT_DIV_ANTENNAS  2    //!< Number of antennas.
+
+/**
+ * @brief Configuration of the antenna diversity feature.
+ */
+typedef struct
+{
+    bool    enable;   //!< If the antenna select pin is driven by the driver.
+    uint8_t gpio_pin; //!< The antenna select pin.
+} nrf_802154_ant_div_cfg_t;
+
+/**
+ * @brief Statistics of the antenna diversity feature.
+ */
+typedef struct
+{
+    uint32_t selected_count[NRF_802154_ANT_DIV_ANTENNAS]; //!< Number of times each antenna was selected for reception or transmission.
+    uint32_t rx_count[NRF_802154_ANT_DIV_ANTENNAS];       //!< Number of frames received with each antenna.
+    uint32_t tx_count[NRF_802154_ANT_DIV_ANTENNAS];       //!< Number of frames requesting ACK transmitted with each antenna.
+    uint32_t ack_count[NRF_802154_ANT_DIV_ANTENNAS];      //!< Number of these frames that were acknowledged.
+    int8_t   rssi[NRF_802154_ANT_DIV_ANTENNAS];           //!< Average RSSI of frames received with each antenna [dBm].
+} nrf_802154_ant_div_stats_t;
+
 /**
  *@}
  **/
@@ -34,6 +34,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include "nrf.h"
+#include "nrf_802154_config.h"
 
 /**
  * @defgroup nrf_802154_utils Utils definitions used in the 802.15.4 driver.
@@ -139,6 +140,62 @@ static inline uint64_t NRF_802154_US_TO_RTC_TICKS(uint64_t time)
     return result;
 }
 
+#if NRF_802154_RAM_CODE_ENABLED
+
+#if defined(__ICCARM__)
+/**@brief Places a function in RAM. */
+#define NRF_802154_RAM_CODE __ramfunc
+/**@brief Places a lookup table of a RAM function in RAM. */
+#define NRF_802154_RAM_DATA
+#else
+#define NRF_802154_RAM_CODE __attribute__((section(".ramfunc.nrf_802154")))
+#define NRF_802154_RAM_DATA __attribute__((section(".data.nrf_802154_ram_data")))
+#endif
+
+#if defined(__GNUC__)
+/**@brief Moves a rarely executed function out of line of the timing-critical path. */
+#define NRF_802154_COLD     __attribute__((cold, noinline))
+#else
+#define NRF_802154_COLD
+#endif
+
+#else // NRF_802154_RAM_CODE_ENABLED
+
+#define NRF_802154_RAM_CODE
+#define NRF_802154_RAM_DATA
+#define NRF_802154_COLD
+
+#endif // NRF_802154_RAM_CODE_ENABLED
+
+#if NRF_802154_MULTI_INSTANCE_ENABLED
+
+/**@brief Index of the driver instance selected by @ref nrf_802154_instance_select.
+ *
+ * Each host thread selects its instance independently, so simulated radios can run in parallel.
+ */
+extern _Thread_local uint32_t nrf_802154_instance_id;
+
+/**@brief Defines a state variable that has a separate copy for each driver instance. */
+#define NRF_802154_PER_INSTANCE(name)     name##_inst[NRF_802154_INSTANCE_COUNT]
+
+/**@brief Initializer of each copy of a variable defined with @ref NRF_802154_PER_INSTANCE.
+ *
+ * @note This macro uses the GNU range designated initializer extension ([first ... last]),
+ *       supported by GCC and Clang.
+ */
+#define NRF_802154_PER_INSTANCE_INIT(...) { [0 ... (NRF_802154_INSTANCE_COUNT - 1)] = __VA_ARGS__ }
+
+/**@brief Copy of a variable defined with @ref NRF_802154_PER_INSTANCE used by the selected instance. */
+#define NRF_802154_INSTANCE_OF(name)      (name##_inst[nrf_802154_instance_id])
+
+#else // NRF_802154_MULTI_INSTANCE_ENABLED
+
+#define NRF_802154_PER_INSTANCE(name)     name
+#define NRF_802154_PER_INSTANCE_INIT(...) __VA_ARGS__
+#define NRF_802154_INSTANCE_OF(name)      name
+
+#endif // NRF_802154_MULTI_INSTANCE_ENABLED
+
 /**@brief Checks if the provided interrupt is currently enabled.
  *
  * @note This function is valid only for ARM Cortex-M4 core.
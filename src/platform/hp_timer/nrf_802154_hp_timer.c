@@ -51,7 +51,30 @@
 /**@brief Timer instance. */
 #define TIMER                       NRF_TIMER0
 
+#if RAAL_SOFTDEVICE && NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED
+#error "High Precision Timer trigger cannot be used with SoftDevice RAAL"
+#endif
+
+#if (RAAL_SOFTDEVICE || RAAL_SIMULATOR) && NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+#error "High Precision Timer alarm cannot be used with SoftDevice or simulator RAAL"
+#endif
+
+#if NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED && NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+#error "High Precision Timer trigger and alarm cannot be used at the same time"
+#endif
+
+/**@brief Timer interrupt definitions. */
+#define TIMER_IRQn                  TIMER0_IRQn
+#define TIMER_IRQHandler            TIMER0_IRQHandler
+
 /**@brief Timer compare channel definitions. */
+#define TIMER_CC_TRIGGER            NRF_TIMER_CC_CHANNEL0
+#define TIMER_CC_TRIGGER_EVENT      NRF_TIMER_EVENT_COMPARE0
+
+#define TIMER_CC_ALARM              NRF_TIMER_CC_CHANNEL0
+#define TIMER_CC_ALARM_EVENT        NRF_TIMER_EVENT_COMPARE0
+#define TIMER_CC_ALARM_INT          NRF_TIMER_INT_COMPARE0_MASK
+
 #define TIMER_CC_CAPTURE            NRF_TIMER_CC_CHANNEL1
 #define TIMER_CC_CAPTURE_TASK       NRF_TIMER_TASK_CAPTURE1
 
@@ -76,12 +99,23 @@ static inline uint32_t timer_time_get(void)
 
 void nrf_802154_hp_timer_init(void)
 {
-    // Intentionally empty
+#if NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+    NVIC_SetPriority(TIMER_IRQn, NRF_802154_RTC_IRQ_PRIORITY);
+    NVIC_ClearPendingIRQ(TIMER_IRQn);
+    NVIC_EnableIRQ(TIMER_IRQn);
+#endif // NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
 }
 
 void nrf_802154_hp_timer_deinit(void)
 {
     nrf_timer_task_trigger(TIMER, NRF_TIMER_TASK_SHUTDOWN);
+
+#if NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+    nrf_802154_hp_timer_alarm_stop();
+
+    NVIC_DisableIRQ(TIMER_IRQn);
+    NVIC_ClearPendingIRQ(TIMER_IRQn);
+#endif // NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
 }
 
 void nrf_802154_hp_timer_start(void)
@@ -99,6 +133,16 @@ void nrf_802154_hp_timer_stop(void)
 #if !RAAL_SOFTDEVICE && !RAAL_SIMULATOR
     nrf_timer_task_trigger(TIMER, NRF_TIMER_TASK_SHUTDOWN);
 #endif // !RAAL_SOFTDEVICE && !RAAL_SIMULATOR
+
+#if NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+    // Timer value is lost, so the alarm would expire at invalid time.
+    nrf_802154_hp_timer_alarm_stop();
+#endif // NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+}
+
+uint32_t nrf_802154_hp_timer_current_time_get(void)
+{
+    return timer_time_get();
 }
 
 uint32_t nrf_802154_hp_timer_sync_task_get(void)
@@ -140,3 +184,51 @@ uint32_t nrf_802154_hp_timer_timestamp_get(void)
     return nrf_timer_cc_read(TIMER, TIMER_CC_EVT);
 }
 
+uint32_t nrf_802154_hp_timer_trigger_event_get(void)
+{
+    return (uint32_t)nrf_timer_event_address_get(TIMER, TIMER_CC_TRIGGER_EVENT);
+}
+
+void nrf_802154_hp_timer_trigger_set(uint32_t trigger_time)
+{
+    nrf_timer_event_clear(TIMER, TIMER_CC_TRIGGER_EVENT);
+    nrf_timer_cc_write(TIMER, TIMER_CC_TRIGGER, trigger_time);
+}
+
+#if NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+bool nrf_802154_hp_timer_alarm_start(uint32_t alarm_time)
+{
+    nrf_timer_int_disable(TIMER, TIMER_CC_ALARM_INT);
+    nrf_timer_event_clear(TIMER, TIMER_CC_ALARM_EVENT);
+    nrf_timer_cc_write(TIMER, TIMER_CC_ALARM, alarm_time);
+    nrf_timer_int_enable(TIMER, TIMER_CC_ALARM_INT);
+
+    if ((int32_t)(alarm_time - timer_time_get()) <= 0)
+    {
+        nrf_802154_hp_timer_alarm_stop();
+        return false;
+    }
+
+    return true;
+}
+
+void nrf_802154_hp_timer_alarm_stop(void)
+{
+    nrf_timer_int_disable(TIMER, TIMER_CC_ALARM_INT);
+    nrf_timer_event_clear(TIMER, TIMER_CC_ALARM_EVENT);
+    NVIC_ClearPendingIRQ(TIMER_IRQn);
+}
+
+void TIMER_IRQHandler(void)
+{
+    if (nrf_timer_int_enable_check(TIMER, TIMER_CC_ALARM_INT) &&
+        nrf_timer_event_check(TIMER, TIMER_CC_ALARM_EVENT))
+    {
+        nrf_timer_int_disable(TIMER, TIMER_CC_ALARM_INT);
+        nrf_timer_event_clear(TIMER, TIMER_CC_ALARM_EVENT);
+
+        nrf_802154_hp_timer_alarm_fired();
+    }
+}
+#endif // NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+
@@ -134,6 +134,46 @@ uint32_t nrf_802154_hp_timer_timestamp_task_get(void);
  */
 uint32_t nrf_802154_hp_timer_timestamp_get(void);
 
+/**
+ * @brief Get event generated when the timer reaches time set by
+ *        @ref nrf_802154_hp_timer_trigger_set.
+ *
+ * This function should be used to configure PPI.
+ *
+ * @returns  Address of the event.
+ */
+uint32_t nrf_802154_hp_timer_trigger_event_get(void);
+
+/**
+ * @brief Set time at which the trigger event is generated.
+ *
+ * @param[in]  trigger_time  Timer value at which the trigger event is generated [us].
+ */
+void nrf_802154_hp_timer_trigger_set(uint32_t trigger_time);
+
+/**
+ * @brief Start one-shot alarm that expires at specified timer value.
+ *
+ * When the alarm expires @ref nrf_802154_hp_timer_alarm_fired is called. The alarm is stopped
+ * when the timer is stopped.
+ *
+ * @param[in]  alarm_time  Timer value at which the alarm expires [us].
+ *
+ * @retval true   Alarm was started.
+ * @retval false  @p alarm_time is not in future. Alarm was not started.
+ */
+bool nrf_802154_hp_timer_alarm_start(uint32_t alarm_time);
+
+/**
+ * @brief Stop currently running alarm.
+ */
+void nrf_802154_hp_timer_alarm_stop(void);
+
+/**
+ * @brief Callback executed when the alarm expires.
+ */
+extern void nrf_802154_hp_timer_alarm_fired(void);
+
 
 /**
  *@}
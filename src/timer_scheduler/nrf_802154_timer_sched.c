@@ -47,17 +47,25 @@
 #include <stdint.h>
 
 #include <nrf.h>
+#include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_timer_coord.h"
+#include "nrf_802154_utils.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
 
 #if defined(__ICCARM__)
     _Pragma("diag_suppress=Pe167")
 #endif
 
-static volatile uint8_t              m_timer_mutex;        ///< Mutex for starting the timer.
-static volatile uint8_t              m_fired_mutex;        ///< Mutex for the timer firing procedure.
-static volatile uint8_t              m_queue_changed_cntr; ///< Information that scheduler queue was modified.
-static volatile nrf_802154_timer_t * mp_head;              ///< Head of the running timers list.
+static volatile uint8_t              NRF_802154_PER_INSTANCE(m_timer_mutex);        ///< Mutex for starting the timer.
+static volatile uint8_t              NRF_802154_PER_INSTANCE(m_fired_mutex);        ///< Mutex for the timer firing procedure.
+static volatile uint8_t              NRF_802154_PER_INSTANCE(m_queue_changed_cntr); ///< Information that scheduler queue was modified.
+static volatile nrf_802154_timer_t * NRF_802154_PER_INSTANCE(mp_head);              ///< Head of the running timers list.
+#define m_timer_mutex        NRF_802154_INSTANCE_OF(m_timer_mutex)
+#define m_fired_mutex        NRF_802154_INSTANCE_OF(m_fired_mutex)
+#define m_queue_changed_cntr NRF_802154_INSTANCE_OF(m_queue_changed_cntr)
+#define mp_head              NRF_802154_INSTANCE_OF(mp_head)
 
 /** @brief Non-blocking mutex for starting the timer.
  *
@@ -131,6 +139,44 @@ static inline bool is_timer_prior(const nrf_802154_timer_t * p_timer_1,
     return is_time_before(p_timer_1->t0 + p_timer_1->dt, p_timer_2->t0 + p_timer_2->dt);
 }
 
+/**
+ * @brief Start timers to expire at given time.
+ *
+ * If the HP timer is running and synchronized, the HP timer alarm expires at given time and the
+ * LP timer is started one tick later in case the HP timer stops before the alarm expires.
+ * Otherwise only the LP timer is used.
+ *
+ * @param[in]  t0  Base time of the expiration [us].
+ * @param[in]  dt  Time delta from @p t0 [us].
+ */
+static inline void timer_start(uint32_t t0, uint32_t dt)
+{
+#if NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+    uint32_t hp_time;
+
+    if (nrf_802154_timer_coord_hp_time_get(t0 + dt, &hp_time) &&
+        nrf_802154_hp_timer_alarm_start(hp_time))
+    {
+        nrf_802154_lp_timer_start(t0, dt + nrf_802154_lp_timer_granularity_get());
+        return;
+    }
+#endif // NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+
+    nrf_802154_lp_timer_start(t0, dt);
+}
+
+/**
+ * @brief Stop timers started by @ref timer_start.
+ */
+static inline void timer_stop(void)
+{
+#if NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+    nrf_802154_hp_timer_alarm_stop();
+#endif // NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+
+    nrf_802154_lp_timer_stop();
+}
+
 /**
  * @brief Handle operation on timer with mutex protection.
  */
@@ -148,7 +194,7 @@ static inline void handle_timer(void)
         {
             if (p_head == NULL)
             {
-                nrf_802154_lp_timer_stop();
+                timer_stop();
             }
             else
             {
@@ -159,7 +205,7 @@ static inline void handle_timer(void)
                 // between reading t0 and dt and not be a valid combination.
                 if (p_head == mp_head)
                 {
-                    nrf_802154_lp_timer_start(t0, dt);
+                    timer_start(t0, dt);
                 }
             }
 
@@ -176,6 +222,7 @@ static inline void handle_timer(void)
  * @retval true   @sa handle_timer() shall be called by caller of this function.
  * @retval false  @sa handle_timer() shall not be called by the caller.
  */
+NRF_802154_RAM_CODE
 static bool timer_remove(nrf_802154_timer_t * p_timer)
 {
     assert(p_timer != NULL);
@@ -275,7 +322,7 @@ void nrf_802154_timer_sched_init(void)
 
 void nrf_802154_timer_sched_deinit(void)
 {
-    nrf_802154_lp_timer_stop();
+    timer_stop();
 
     mp_head = NULL;
 }
@@ -407,10 +454,12 @@ bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
     return result;
 }
 
-void nrf_802154_lp_timer_fired(void)
+/**
+ * @brief Handle expiration of the HEAD timer.
+ */
+NRF_802154_RAM_CODE
+static void timer_fired(void)
 {
-    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TSCH_FIRED);
-
     if (mutex_trylock(&m_fired_mutex))
     {
         nrf_802154_timer_t * p_timer   = (nrf_802154_timer_t *) mp_head;
@@ -432,6 +481,26 @@ void nrf_802154_lp_timer_fired(void)
     }
 
     handle_timer();
+}
+
+NRF_802154_RAM_CODE
+void nrf_802154_lp_timer_fired(void)
+{
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TSCH_FIRED);
+
+    timer_fired();
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TSCH_FIRED);
+}
+
+#if NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
+NRF_802154_RAM_CODE
+void nrf_802154_hp_timer_alarm_fired(void)
+{
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TSCH_FIRED);
+
+    timer_fired();
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TSCH_FIRED);
 }
+#endif // NRF_802154_TIMER_SCHED_HP_LANE_ENABLED
@@ -131,6 +131,12 @@ bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_
  *       Use @p round_up to specify if given timer should be expired before or after time given in
  *       the @p p_timer structure. The dt field of the @p p_timer is updated with the rounded up value.
  *
+ * @note If @ref NRF_802154_TIMER_SCHED_HP_LANE_ENABLED is set and the HP timer is running, the
+ *       callback function is called at specified time with microsecond accuracy. Time returned by
+ *       @ref nrf_802154_timer_sched_time_get is limited to the LP timer granularity, so in the
+ *       callback it may not have reached t0 + dt yet. Callbacks must not compare it against their
+ *       expiration time.
+ *
  * @param[inout]  p_timer   Pointer to the timer to start and add to the scheduler.
  * @param[in]     round_up  True if timer should expire after specified time, false if it should
  *                          expire before.
@@ -0,0 +1,208 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "mock_nrf_gpio.h"
+#include "mock_nrf_gpiote.h"
+#include "mock_nrf_ppi.h"
+
+#include "nrf_coex_control.c"
+
+#define REQUEST_GPIOTE_CH  4
+#define PRIORITY_GPIOTE_CH 5
+#define CLR_PPI_CH         16
+#define GRANT_PIN          31
+#define TEST_PPI_CH        NRF_PPI_CHANNEL8
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    m_cfg = (nrf_coex_control_cfg_t){
+        .request_cfg           = { .enable = 1, .active_high = 1, .gpio_pin = 29 },
+        .priority_cfg          = { .enable = 1, .active_high = 1, .gpio_pin = 30 },
+        .grant_cfg             = { .enable = 1, .active_high = 1, .gpio_pin = GRANT_PIN },
+        .request_gpiote_ch_id  = REQUEST_GPIOTE_CH,
+        .priority_gpiote_ch_id = PRIORITY_GPIOTE_CH,
+        .ppi_ch_id_clr         = CLR_PPI_CH,
+        .tx_high_priority      = false,
+    };
+}
+
+void tearDown(void)
+{
+    m_stats = (nrf_coex_control_stats_t){0};
+}
+
+static void verify_release(void)
+{
+    nrf_ppi_channel_disable_Expect((nrf_ppi_channel_t)CLR_PPI_CH);
+    nrf_gpiote_task_force_Expect(REQUEST_GPIOTE_CH, NRF_GPIOTE_INITIAL_VALUE_LOW);
+    nrf_gpiote_task_force_Expect(PRIORITY_GPIOTE_CH, NRF_GPIOTE_INITIAL_VALUE_LOW);
+}
+
+/***********************************************************************************/
+/************************************ TX DELAY *************************************/
+/***********************************************************************************/
+
+void test_tx_delay_get_ShallReturnZeroIfRequestIsDisabled(void)
+{
+    m_cfg.request_cfg.enable = 0;
+
+    TEST_ASSERT_EQUAL_UINT32(0, nrf_coex_control_tx_delay_get());
+}
+
+void test_tx_delay_get_ShallReturnDefaultIfTimeIsNotConfigured(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(NRF_COEX_CONTROL_DEFAULT_REQUEST_TO_GRANT_TIME,
+                             nrf_coex_control_tx_delay_get());
+}
+
+void test_tx_delay_get_ShallReturnConfiguredTime(void)
+{
+    m_cfg.request_to_grant_time_us = 50;
+
+    TEST_ASSERT_EQUAL_UINT32(50, nrf_coex_control_tx_delay_get());
+}
+
+/***********************************************************************************/
+/*********************************** TX REQUEST ************************************/
+/***********************************************************************************/
+
+void test_tx_request_ppi_setup_ShallDoNothingIfRequestIsDisabled(void)
+{
+    m_cfg.request_cfg.enable = 0;
+
+    nrf_coex_control_tx_request_ppi_setup(TEST_PPI_CH);
+
+    TEST_ASSERT_EQUAL_UINT32(0, m_stats.tx_requested);
+}
+
+void test_tx_request_ppi_setup_ShallRaiseRequestOnPpiFork(void)
+{
+    nrf_ppi_channel_disable_Expect((nrf_ppi_channel_t)CLR_PPI_CH);
+    nrf_gpiote_task_force_Expect(PRIORITY_GPIOTE_CH, NRF_GPIOTE_INITIAL_VALUE_LOW);
+    nrf_ppi_fork_endpoint_setup_Expect(TEST_PPI_CH,
+                                       (uint32_t)(&NRF_GPIOTE->TASKS_SET[REQUEST_GPIOTE_CH]));
+
+    nrf_coex_control_tx_request_ppi_setup(TEST_PPI_CH);
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.tx_requested);
+}
+
+void test_tx_request_ppi_setup_ShallRaisePriorityIfConfigured(void)
+{
+    m_cfg.tx_high_priority = true;
+
+    nrf_ppi_channel_disable_Expect((nrf_ppi_channel_t)CLR_PPI_CH);
+    nrf_gpiote_task_force_Expect(PRIORITY_GPIOTE_CH, NRF_GPIOTE_INITIAL_VALUE_HIGH);
+    nrf_ppi_fork_endpoint_setup_Expect(TEST_PPI_CH,
+                                       (uint32_t)(&NRF_GPIOTE->TASKS_SET[REQUEST_GPIOTE_CH]));
+
+    nrf_coex_control_tx_request_ppi_setup(TEST_PPI_CH);
+}
+
+void test_tx_request_ppi_setup_ShallUseClearTaskForActiveLowRequest(void)
+{
+    m_cfg.request_cfg.active_high = 0;
+
+    nrf_ppi_channel_disable_Expect((nrf_ppi_channel_t)CLR_PPI_CH);
+    nrf_gpiote_task_force_Expect(PRIORITY_GPIOTE_CH, NRF_GPIOTE_INITIAL_VALUE_LOW);
+    nrf_ppi_fork_endpoint_setup_Expect(TEST_PPI_CH,
+                                       (uint32_t)(&NRF_GPIOTE->TASKS_CLR[REQUEST_GPIOTE_CH]));
+
+    nrf_coex_control_tx_request_ppi_setup(TEST_PPI_CH);
+}
+
+/***********************************************************************************/
+/************************************ TX GRANT *************************************/
+/***********************************************************************************/
+
+void test_tx_grant_check_ShallPassIfRequestIsDisabled(void)
+{
+    m_cfg.request_cfg.enable = 0;
+
+    TEST_ASSERT_TRUE(nrf_coex_control_tx_grant_check());
+}
+
+void test_tx_grant_check_ShallPassIfGrantIsNotUsed(void)
+{
+    m_cfg.grant_cfg.enable = 0;
+
+    TEST_ASSERT_TRUE(nrf_coex_control_tx_grant_check());
+    TEST_ASSERT_EQUAL_UINT32(0, m_stats.tx_denied);
+}
+
+void test_tx_grant_check_ShallKeepRequestIfGranted(void)
+{
+    nrf_gpio_pin_read_ExpectAndReturn(GRANT_PIN, 1);
+
+    TEST_ASSERT_TRUE(nrf_coex_control_tx_grant_check());
+    TEST_ASSERT_EQUAL_UINT32(0, m_stats.tx_denied);
+}
+
+void test_tx_grant_check_ShallReleaseRequestIfDenied(void)
+{
+    nrf_gpio_pin_read_ExpectAndReturn(GRANT_PIN, 0);
+    verify_release();
+
+    TEST_ASSERT_FALSE(nrf_coex_control_tx_grant_check());
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.tx_denied);
+}
+
+void test_tx_grant_check_ShallHandleActiveLowGrant(void)
+{
+    m_cfg.grant_cfg.active_high = 0;
+
+    nrf_gpio_pin_read_ExpectAndReturn(GRANT_PIN, 0);
+
+    TEST_ASSERT_TRUE(nrf_coex_control_tx_grant_check());
+}
+
+/***********************************************************************************/
+/*********************************** ACK REQUEST ***********************************/
+/***********************************************************************************/
+
+void test_ack_request_ShallRaiseLinesAndEnableReleaseOnDisabled(void)
+{
+    nrf_gpiote_task_force_Expect(PRIORITY_GPIOTE_CH, NRF_GPIOTE_INITIAL_VALUE_HIGH);
+    nrf_gpiote_task_force_Expect(REQUEST_GPIOTE_CH, NRF_GPIOTE_INITIAL_VALUE_HIGH);
+    nrf_gpio_pin_read_ExpectAndReturn(GRANT_PIN, 0);
+    nrf_ppi_channel_enable_Expect((nrf_ppi_channel_t)CLR_PPI_CH);
+
+    nrf_coex_control_ack_request();
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.ack_requested);
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.ack_denied);
+}
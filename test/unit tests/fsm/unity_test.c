@@ -35,6 +35,7 @@
 #include "mock_nrf_802154.h"
 #include "mock_nrf_802154_ack_pending_bit.h"
 #include "mock_nrf_802154_core_hooks.h"
+#include "mock_nrf_802154_critical_section.h"
 #include "mock_nrf_802154_debug.h"
 #include "mock_nrf_802154_notification.h"
 #include "mock_nrf_802154_pib.h"
@@ -79,3 +80,138 @@ void test_ShouldPass(void)
 {
     TEST_ASSERT_EQUAL_UINT32(0, 0);
 }
+
+/** Interrupt enable mask of all RADIO events that may be handled by the core. */
+#define ALL_EVENTS_MASK 0xffffffffUL
+
+/** Expect that the RADIO IRQ handler checks an event that is not set. */
+static void event_not_set_expect(nrf_radio_event_t event)
+{
+    nrf_radio_event_get_ExpectAndReturn(event, false);
+}
+
+/** RADIO event of each entry of the core FSM description. */
+#define FSM_EVENT(event, state, handler) NRF_RADIO_EVENT_##event,
+
+static const nrf_radio_event_t m_fsm_events[] =
+{
+    IRQ_FSM(FSM_EVENT)
+};
+
+/** Expect that the RADIO IRQ handler checks each event of the core FSM once, in order of the FSM. */
+static void fsm_events_not_set_expect(bool has_phyend)
+{
+    for (uint32_t i = 0; i < sizeof(m_fsm_events) / sizeof(m_fsm_events[0]); i++)
+    {
+        // Entries of the same event are consecutive.
+        if ((i > 0) && (m_fsm_events[i] == m_fsm_events[i - 1]))
+        {
+            continue;
+        }
+
+        if ((m_fsm_events[i] == NRF_RADIO_EVENT_PHYEND) && !has_phyend)
+        {
+            continue;
+        }
+
+        event_not_set_expect(m_fsm_events[i]);
+    }
+}
+
+void test_irq_handler_ShallCheckEventsInFixedOrder(void)
+{
+    nrf_802154_critical_section_forcefully_enter_Expect();
+    nrf_radio_int_enable_get_ExpectAndReturn(ALL_EVENTS_MASK);
+    nrf_802154_revision_has_phyend_event_ExpectAndReturn(true);
+
+    // Order of the events does not follow the order of INTEN bits.
+    fsm_events_not_set_expect(true);
+
+    nrf_802154_critical_section_exit_Expect();
+
+    irq_handler();
+}
+
+void test_irq_handler_ShallNotCheckPhyendOnRevisionWithoutPhyend(void)
+{
+    nrf_802154_critical_section_forcefully_enter_Expect();
+    nrf_radio_int_enable_get_ExpectAndReturn(ALL_EVENTS_MASK);
+    nrf_802154_revision_has_phyend_event_ExpectAndReturn(false);
+
+    fsm_events_not_set_expect(false);
+
+    nrf_802154_critical_section_exit_Expect();
+
+    irq_handler();
+}
+
+void test_irq_fsm_ShallListEventsInHandlingOrder(void)
+{
+    uint32_t event_id;
+    uint32_t prev_event_id = 0;
+
+    for (uint32_t i = 0; i < sizeof(m_fsm_events) / sizeof(m_fsm_events[0]); i++)
+    {
+        for (event_id = 0; event_id < IRQ_EVENT_COUNT; event_id++)
+        {
+            if (m_irq_event_registers[event_id] == m_fsm_events[i])
+            {
+                break;
+            }
+        }
+
+        TEST_ASSERT_TRUE(event_id < IRQ_EVENT_COUNT);
+        TEST_ASSERT_TRUE(event_id >= prev_event_id);
+
+        prev_event_id = event_id;
+    }
+}
+
+void test_irq_handler_ShallNotCheckEventsWithDisabledInterrupts(void)
+{
+    nrf_802154_critical_section_forcefully_enter_Expect();
+    nrf_radio_int_enable_get_ExpectAndReturn(NRF_RADIO_INT_END_MASK | NRF_RADIO_INT_CRCOK_MASK);
+
+    event_not_set_expect(NRF_RADIO_EVENT_CRCOK);
+    event_not_set_expect(NRF_RADIO_EVENT_END);
+
+    nrf_802154_critical_section_exit_Expect();
+
+    irq_handler();
+}
+
+void test_irq_handler_ShallSkipEventWhichInterruptWasDisabledByHandler(void)
+{
+    m_state = RADIO_STATE_TX_ACK;
+
+    nrf_802154_critical_section_forcefully_enter_Expect();
+    nrf_radio_int_enable_get_ExpectAndReturn(NRF_RADIO_INT_END_MASK | NRF_RADIO_INT_DISABLED_MASK);
+
+    nrf_radio_event_get_ExpectAndReturn(NRF_RADIO_EVENT_END, true);
+    nrf_radio_event_clear_Expect(NRF_RADIO_EVENT_END);
+    nrf_802154_revision_has_phyend_event_ExpectAndReturn(true);
+    nrf_radio_int_enable_get_ExpectAndReturn(NRF_RADIO_INT_END_MASK);
+
+    nrf_802154_critical_section_exit_Expect();
+
+    irq_handler();
+}
+
+void test_irq_handler_ShallHandleEventWhichInterruptWasEnabledByHandler(void)
+{
+    m_state = RADIO_STATE_TX_ACK;
+
+    nrf_802154_critical_section_forcefully_enter_Expect();
+    nrf_radio_int_enable_get_ExpectAndReturn(NRF_RADIO_INT_END_MASK);
+
+    nrf_radio_event_get_ExpectAndReturn(NRF_RADIO_EVENT_END, true);
+    nrf_radio_event_clear_Expect(NRF_RADIO_EVENT_END);
+    nrf_802154_revision_has_phyend_event_ExpectAndReturn(true);
+    nrf_radio_int_enable_get_ExpectAndReturn(NRF_RADIO_INT_END_MASK | NRF_RADIO_INT_DISABLED_MASK);
+
+    event_not_set_expect(NRF_RADIO_EVENT_DISABLED);
+
+    nrf_802154_critical_section_exit_Expect();
+
+    irq_handler();
+}
@@ -853,6 +853,9 @@ void test_OnPhyendEventStateTx_ShallNotifyFrameAndNotSetupAckMatchAcceleratorIfA
 void test_OnEndEventStateRxAck_ShallCallTransmitFailedOnAckMismatch(void)
 {
     nrf_radio_event_get_ExpectAndReturn(NRF_RADIO_EVENT_MHRMATCH, false);
+#if NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+    nrf_radio_crc_status_get_ExpectAndReturn(NRF_RADIO_CRC_STATUS_ERROR);
+#endif // NRF_802154_RX_DURING_ACK_WAIT_ENABLED
 
     mock_rx_ack_terminate();
     mock_receive_begin(true, NRF_RADIO_SHORT_ADDRESS_RSSISTART_MASK |
@@ -865,6 +868,44 @@ void test_OnEndEventStateRxAck_ShallCallTransmitFailedOnAckMismatch(void)
     irq_end_state_rx_ack();
 }
 
+#if NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+void test_OnEndEventStateRxAck_ShallNotifyReceivedFrameAndKeepWaitingForAckOnFilteredFrame(void)
+{
+    static rx_buffer_t next_rx_buffer;
+
+    next_rx_buffer.free                      = true;
+    m_test_rx_buffer.psdu[FRAME_TYPE_OFFSET] = FRAME_TYPE_DATA;
+
+    nrf_radio_event_get_ExpectAndReturn(NRF_RADIO_EVENT_MHRMATCH, false);
+    nrf_radio_crc_status_get_ExpectAndReturn(NRF_RADIO_CRC_STATUS_OK);
+    nrf_802154_pib_promiscuous_get_ExpectAndReturn(false);
+    nrf_802154_filter_frame_part_ExpectAndReturn(m_test_rx_buffer.psdu, NULL, NRF_802154_RX_ERROR_NONE);
+    nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
+
+    // Restart receiver with a new buffer.
+    nrf_802154_rx_buffer_free_find_ExpectAndReturn(&next_rx_buffer);
+    nrf_ppi_channel_disable_Expect(PPI_DISABLED_EGU);
+    nrf_radio_packet_ptr_set_Expect(next_rx_buffer.psdu);
+    nrf_radio_shorts_set_Expect(NRF_RADIO_SHORT_ADDRESS_RSSISTART_MASK |
+                                NRF_RADIO_SHORT_END_DISABLE_MASK |
+                                NRF_RADIO_SHORT_RXREADY_START_MASK);
+    nrf_radio_event_clear_Expect(NRF_RADIO_EVENT_MHRMATCH);
+    nrf_timer_task_trigger_Expect(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+    nrf_ppi_channel_enable_Expect(PPI_EGU_RAMP_UP);
+    nrf_egu_event_clear_Expect(NRF_802154_SWI_EGU_INSTANCE, EGU_EVENT);
+    nrf_ppi_channel_enable_Expect(PPI_DISABLED_EGU);
+    mock_ppi_egu_worked(true);
+
+    mock_received_frame_notify();
+
+    m_state = RADIO_STATE_RX_ACK;
+    irq_end_state_rx_ack();
+
+    TEST_ASSERT_EQUAL(RADIO_STATE_RX_ACK, m_state);
+    TEST_ASSERT_EQUAL(false, m_test_rx_buffer.free);
+}
+#endif // NRF_802154_RX_DURING_ACK_WAIT_ENABLED
+
 void test_OnEndEventStateRxAck_ShallNotifyFrameTransmittedOnAckMatch(void)
 {
     nrf_radio_event_get_ExpectAndReturn(NRF_RADIO_EVENT_MHRMATCH, true);
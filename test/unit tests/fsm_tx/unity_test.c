@@ -246,6 +246,19 @@ static void verify_complete_receive_begin(void)
     verify_receive_begin_finds_free_buffer();
 }
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+static void verify_idle_after_tx_is_sleep(void)
+{
+    nrf_802154_pib_rx_on_when_idle_get_ExpectAndReturn(false);
+    nrf_802154_pib_rx_window_after_tx_get_ExpectAndReturn(0);
+
+    m_rsch_timeslot_is_granted = true;
+    nrf_radio_event_clear_Expect(NRF_RADIO_EVENT_DISABLED);
+    nrf_radio_int_enable_Expect(NRF_RADIO_INT_DISABLED_MASK);
+    nrf_radio_state_get_ExpectAndReturn(NRF_RADIO_STATE_TX_DISABLE);
+}
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
 static void verify_complete_ack_matching_enable(void)
 {
     uint8_t sequence_number = rand();
@@ -751,6 +764,21 @@ void test_ccabusy_handler_ShallResetToRxStateAndNotifyFailure(void)
     irq_ccabusy_state_tx_frame();
 }
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+void test_ccabusy_handler_ShallFallAsleepIfRxIsOffWhenIdle(void)
+{
+    insert_frame_with_noack_to_tx_buffer();
+
+    verify_tx_terminate_periph_reset(true);
+    verify_idle_after_tx_is_sleep();
+
+    verify_transmit_failed_notification(NRF_802154_TX_ERROR_BUSY_CHANNEL);
+
+    irq_ccabusy_state_tx_frame();
+    TEST_ASSERT_EQUAL(RADIO_STATE_FALLING_ASLEEP, m_state);
+}
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
 /***************************************************************************************************
  * @section PHYEND handler
  **************************************************************************************************/
@@ -832,6 +860,22 @@ void test_phyend_handler_ShallResetToRxStateAndNotifySuccessIfAckNotRequested(vo
     irq_phyend_state_tx_frame();
 }
 
+#if NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+void test_phyend_handler_ShallFallAsleepAndNotifySuccessIfRxIsOffWhenIdle(void)
+{
+    m_flags.tx_started = true;
+    insert_frame_with_noack_to_tx_buffer();
+
+    verify_tx_terminate_periph_reset(true);
+    verify_idle_after_tx_is_sleep();
+
+    verify_transmitted_notification_noack();
+
+    irq_phyend_state_tx_frame();
+    TEST_ASSERT_EQUAL(RADIO_STATE_FALLING_ASLEEP, m_state);
+}
+#endif // NRF_802154_RX_WINDOW_AFTER_TX_ENABLED
+
 void test_phyend_handler_ShallSetPeriphToRxAckIfRequested(void)
 {
     m_flags.tx_started = true;
@@ -0,0 +1,284 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdlib.h>
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mock_nrf_802154.h"
+#include "mock_nrf_802154_ack_pending_bit.h"
+#include "mock_nrf_802154_core_hooks.h"
+#include "mock_nrf_802154_critical_section.h"
+#include "mock_nrf_802154_debug.h"
+#include "mock_nrf_802154_notification.h"
+#include "mock_nrf_802154_pib.h"
+#include "mock_nrf_802154_priority_drop.h"
+#include "mock_nrf_802154_procedures_duration.h"
+#include "mock_nrf_802154_revision.h"
+#include "mock_nrf_802154_rsch.h"
+#include "mock_nrf_802154_rssi.h"
+#include "mock_nrf_802154_rx_buffer.h"
+#include "mock_nrf_802154_timer_coord.h"
+#include "mock_nrf_802154_timer_sched.h"
+#include "mock_nrf_coex_control_api.h"
+#include "mock_nrf_fem_control_api.h"
+#include "mock_nrf_radio.h"
+#include "mock_nrf_timer.h"
+#include "mock_nrf_egu.h"
+#include "mock_nrf_ppi.h"
+
+#define __ISB()
+#define __LDREXB(ptr)           0
+#define __STREXB(value, ptr)    0
+
+#include "nrf_802154_core.c"
+
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+#define COEX_DELAY 20 ///< Request-to-grant time used by the tests [us].
+
+static uint8_t m_tx_buffer[MAX_PACKET_SIZE + 1];
+
+static void insert_frame_with_noack_to_tx_buffer(void)
+{
+    mp_tx_data = m_tx_buffer;
+    m_tx_buffer[0] = 16;
+    m_tx_buffer[1] = 0x41;
+}
+
+static void verify_tx_terminate(void)
+{
+    uint32_t ints_to_disable;
+
+    nrf_ppi_channel_disable_Expect(PPI_DISABLED_EGU);
+    nrf_ppi_channel_disable_Expect(PPI_EGU_RAMP_UP);
+
+    nrf_fem_control_ppi_disable_Expect(NRF_FEM_CONTROL_ANY_PIN);
+    nrf_fem_control_timer_reset_Expect(NRF_FEM_CONTROL_ANY_PIN,
+                                       NRF_TIMER_SHORT_COMPARE0_STOP_MASK |
+                                       NRF_TIMER_SHORT_COMPARE1_STOP_MASK);
+    nrf_fem_control_ppi_fork_clear_Expect(NRF_FEM_CONTROL_ANY_PIN, PPI_CCAIDLE_FEM);
+    nrf_ppi_channel_disable_Expect(PPI_CCAIDLE_FEM);
+    nrf_ppi_channel_disable_Expect(PPI_EGU_TIMER_START);
+
+    nrf_coex_control_tx_delay_get_ExpectAndReturn(COEX_DELAY);
+    nrf_ppi_channel_disable_Expect(PPI_EGU_TIMER_START);
+    nrf_ppi_fork_endpoint_setup_Expect(PPI_EGU_TIMER_START, 0);
+    nrf_timer_task_trigger_Expect(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+    nrf_coex_control_release_Expect();
+
+    nrf_ppi_channel_remove_from_group_Expect(PPI_EGU_RAMP_UP, PPI_CHGRP0);
+    nrf_ppi_fork_endpoint_setup_Expect(PPI_EGU_RAMP_UP, 0);
+
+    ints_to_disable = NRF_RADIO_INT_PHYEND_MASK  |
+                      NRF_RADIO_INT_CCABUSY_MASK |
+                      NRF_RADIO_INT_CCAIDLE_MASK;
+#if NRF_802154_TX_STARTED_NOTIFY_ENABLED
+    ints_to_disable |= NRF_RADIO_INT_ADDRESS_MASK;
+#endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
+
+    nrf_802154_revision_has_phyend_event_ExpectAndReturn(true);
+    nrf_radio_int_disable_Expect(ints_to_disable);
+    nrf_radio_shorts_set_Expect(SHORTS_IDLE);
+    nrf_radio_task_trigger_Expect(NRF_RADIO_TASK_CCASTOP);
+    nrf_radio_task_trigger_Expect(NRF_RADIO_TASK_DISABLE);
+}
+
+static void verify_idle_after_tx_is_sleep(void)
+{
+    nrf_802154_pib_rx_on_when_idle_get_ExpectAndReturn(false);
+    nrf_802154_pib_rx_window_after_tx_get_ExpectAndReturn(0);
+
+    nrf_radio_event_clear_Expect(NRF_RADIO_EVENT_DISABLED);
+    nrf_radio_int_enable_Expect(NRF_RADIO_INT_DISABLED_MASK);
+    nrf_radio_state_get_ExpectAndReturn(NRF_RADIO_STATE_TX_DISABLE);
+}
+
+static void verify_coex_denied_notification(void)
+{
+    nrf_802154_critical_section_nesting_allow_Expect();
+
+    nrf_coex_control_release_Expect();
+    nrf_802154_core_hooks_tx_failed_ExpectAndReturn(m_tx_buffer,
+                                                    NRF_802154_TX_ERROR_COEX_DENIED,
+                                                    true);
+    nrf_802154_notify_transmit_failed_Expect(m_tx_buffer, NRF_802154_TX_ERROR_COEX_DENIED);
+
+    nrf_802154_critical_section_nesting_deny_Expect();
+}
+
+void setUp(void)
+{
+    m_rsch_timeslot_is_granted = true;
+}
+
+void tearDown(void)
+{
+
+}
+
+/***************************************************************************************************
+ * @section Notifications
+ **************************************************************************************************/
+
+void nrf_802154_rx_started(void){}
+void nrf_802154_tx_started(const uint8_t * p_frame){}
+
+/***************************************************************************************************
+ * @section GRANT sampling of a frame transmitted without CCA
+ **************************************************************************************************/
+
+void test_tx_coex_grant_check_ShallPassIfArbitrationIsDisabled(void)
+{
+    nrf_coex_control_tx_delay_get_ExpectAndReturn(0);
+
+    TEST_ASSERT_TRUE(tx_coex_grant_check(false));
+}
+
+void test_tx_coex_grant_check_ShallNotWaitIfCcaIsPerformed(void)
+{
+    nrf_coex_control_tx_delay_get_ExpectAndReturn(COEX_DELAY);
+
+    TEST_ASSERT_TRUE(tx_coex_grant_check(true));
+}
+
+void test_tx_coex_grant_check_ShallSampleGrantWhenRampUpIsTriggered(void)
+{
+    uint32_t t0 = rand();
+
+    nrf_coex_control_tx_delay_get_ExpectAndReturn(COEX_DELAY);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(t0);
+
+    nrf_timer_event_check_ExpectAndReturn(NRF_802154_TIMER_INSTANCE,
+                                          NRF_TIMER_EVENT_COMPARE3,
+                                          false);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(t0);
+    nrf_802154_timer_sched_time_is_in_future_ExpectAndReturn(t0,
+                                                             t0,
+                                                             COEX_DELAY + COEX_GRANT_WAIT_MARGIN,
+                                                             true);
+    nrf_timer_event_check_ExpectAndReturn(NRF_802154_TIMER_INSTANCE,
+                                          NRF_TIMER_EVENT_COMPARE3,
+                                          true);
+    nrf_coex_control_tx_grant_check_ExpectAndReturn(true);
+
+    TEST_ASSERT_TRUE(tx_coex_grant_check(false));
+}
+
+void test_tx_coex_grant_check_ShallFailIfMediumIsDenied(void)
+{
+    nrf_coex_control_tx_delay_get_ExpectAndReturn(COEX_DELAY);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(0);
+
+    nrf_timer_event_check_ExpectAndReturn(NRF_802154_TIMER_INSTANCE,
+                                          NRF_TIMER_EVENT_COMPARE3,
+                                          true);
+    nrf_coex_control_tx_grant_check_ExpectAndReturn(false);
+
+    TEST_ASSERT_FALSE(tx_coex_grant_check(false));
+}
+
+void test_tx_coex_grant_check_ShallFailIfRampUpIsNotTriggeredInTime(void)
+{
+    uint32_t t0 = rand();
+
+    nrf_coex_control_tx_delay_get_ExpectAndReturn(COEX_DELAY);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(t0);
+
+    nrf_timer_event_check_ExpectAndReturn(NRF_802154_TIMER_INSTANCE,
+                                          NRF_TIMER_EVENT_COMPARE3,
+                                          false);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(t0 + COEX_DELAY + COEX_GRANT_WAIT_MARGIN);
+    nrf_802154_timer_sched_time_is_in_future_ExpectAndReturn(
+        t0 + COEX_DELAY + COEX_GRANT_WAIT_MARGIN,
+        t0,
+        COEX_DELAY + COEX_GRANT_WAIT_MARGIN,
+        false);
+
+    TEST_ASSERT_FALSE(tx_coex_grant_check(false));
+}
+
+void test_tx_coex_denied_ShallTerminateTransmissionAndNotifyFailure(void)
+{
+    insert_frame_with_noack_to_tx_buffer();
+
+    verify_tx_terminate();
+    verify_idle_after_tx_is_sleep();
+    verify_coex_denied_notification();
+
+    tx_coex_denied();
+
+    TEST_ASSERT_EQUAL(RADIO_STATE_FALLING_ASLEEP, m_state);
+}
+
+/***************************************************************************************************
+ * @section GRANT sampling of a frame transmitted after CCA
+ **************************************************************************************************/
+
+void test_ccaidle_handler_ShallLetTransmitterRampUpIfMediumIsGranted(void)
+{
+    insert_frame_with_noack_to_tx_buffer();
+    m_state = RADIO_STATE_CCA_TX;
+
+    nrf_radio_int_disable_Expect(NRF_RADIO_INT_CCAIDLE_MASK);
+    nrf_coex_control_tx_grant_check_ExpectAndReturn(true);
+
+    irq_ccaidle_state_tx_frame();
+
+    TEST_ASSERT_EQUAL(RADIO_STATE_CCA_TX, m_state);
+}
+
+void test_ccaidle_handler_ShallAbortTransmitterRampUpIfMediumIsDenied(void)
+{
+    insert_frame_with_noack_to_tx_buffer();
+    m_state = RADIO_STATE_CCA_TX;
+
+    nrf_radio_int_disable_Expect(NRF_RADIO_INT_CCAIDLE_MASK);
+    nrf_coex_control_tx_grant_check_ExpectAndReturn(false);
+    verify_tx_terminate();
+    verify_idle_after_tx_is_sleep();
+    verify_coex_denied_notification();
+
+    irq_ccaidle_state_tx_frame();
+
+    TEST_ASSERT_EQUAL(RADIO_STATE_FALLING_ASLEEP, m_state);
+}
+
+void test_ccaidle_handler_ShallBeDispatchedInCcaTxState(void)
+{
+    TEST_ASSERT_EQUAL_PTR(irq_ccaidle_state_tx_frame,
+                          m_irq_handlers[IRQ_EVENT_CCAIDLE][RADIO_STATE_CCA_TX]);
+    TEST_ASSERT_NULL(m_irq_handlers[IRQ_EVENT_CCAIDLE][RADIO_STATE_TX]);
+}
@@ -0,0 +1,238 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define NRF_802154_DELAYED_TX_HP_TIMER_TRIGGER_ENABLED 1
+
+#include <stdlib.h>
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mock_nrf_802154.h"
+#include "mock_nrf_802154_ack_pending_bit.h"
+#include "mock_nrf_802154_core_hooks.h"
+#include "mock_nrf_802154_critical_section.h"
+#include "mock_nrf_802154_debug.h"
+#include "mock_nrf_802154_hp_timer.h"
+#include "mock_nrf_802154_notification.h"
+#include "mock_nrf_802154_pib.h"
+#include "mock_nrf_802154_priority_drop.h"
+#include "mock_nrf_802154_procedures_duration.h"
+#include "mock_nrf_802154_revision.h"
+#include "mock_nrf_802154_rsch.h"
+#include "mock_nrf_802154_rssi.h"
+#include "mock_nrf_802154_rx_buffer.h"
+#include "mock_nrf_802154_timer_coord.h"
+#include "mock_nrf_fem_control_api.h"
+#include "mock_nrf_radio.h"
+#include "mock_nrf_timer.h"
+#include "mock_nrf_egu.h"
+#include "mock_nrf_ppi.h"
+
+#define __ISB()
+#define __LDREXB(ptr)           0
+#define __STREXB(value, ptr)    0
+
+#include "nrf_802154_core.c"
+
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+#define TRIGGER_TIME_LP 1000000UL ///< Requested ramp up time in the LP timer domain [us].
+#define TRIGGER_TIME_HP 5000UL    ///< Requested ramp up time in the HP timer domain [us].
+
+static uint32_t m_hp_trigger_time;
+
+static void verify_hp_time_get(bool result, uint32_t hp_trigger_time)
+{
+    m_hp_trigger_time = hp_trigger_time;
+
+    nrf_802154_timer_coord_hp_time_get_ExpectAndReturn(TRIGGER_TIME_LP, NULL, result);
+    nrf_802154_timer_coord_hp_time_get_IgnoreArg_p_hp_time();
+    nrf_802154_timer_coord_hp_time_get_ReturnThruPtr_p_hp_time(&m_hp_trigger_time);
+}
+
+static void verify_hp_trigger_setup(nrf_radio_task_t ramp_up_task, uint32_t hp_trigger_time)
+{
+    uint32_t event_addr;
+    uint32_t task_addr;
+    uint32_t task2_addr;
+
+    nrf_ppi_channel_disable_Expect(PPI_DISABLED_EGU);
+
+    event_addr = rand();
+    nrf_egu_event_address_get_ExpectAndReturn(NRF_802154_SWI_EGU_INSTANCE,
+                                              EGU_EVENT,
+                                              (uint32_t *)event_addr);
+    task_addr = rand();
+    nrf_radio_task_address_get_ExpectAndReturn(ramp_up_task, (uint32_t *)task_addr);
+    task2_addr = rand();
+    nrf_ppi_task_address_get_ExpectAndReturn(PPI_CHGRP0_DIS_TASK,
+                                             (uint32_t *)task2_addr);
+    nrf_ppi_channel_and_fork_endpoint_setup_Expect(PPI_EGU_RAMP_UP, event_addr, task_addr, task2_addr);
+
+    event_addr = rand();
+    nrf_radio_event_address_get_ExpectAndReturn(NRF_RADIO_EVENT_DISABLED, (uint32_t *)event_addr);
+    task_addr = rand();
+    nrf_egu_task_address_get_ExpectAndReturn(NRF_802154_SWI_EGU_INSTANCE, EGU_TASK, (uint32_t *)task_addr);
+    nrf_ppi_channel_endpoint_setup_Expect(PPI_DISABLED_EGU, event_addr, task_addr);
+
+    event_addr = rand();
+    nrf_802154_hp_timer_trigger_event_get_ExpectAndReturn(event_addr);
+    task_addr = rand();
+    nrf_egu_task_address_get_ExpectAndReturn(NRF_802154_SWI_EGU_INSTANCE, EGU_TASK, (uint32_t *)task_addr);
+    nrf_ppi_channel_endpoint_setup_Expect(PPI_HP_TIMER_EGU, event_addr, task_addr);
+
+    nrf_ppi_channel_include_in_group_Expect(PPI_EGU_RAMP_UP, PPI_CHGRP0);
+    nrf_ppi_channel_include_in_group_Expect(PPI_HP_TIMER_EGU, PPI_CHGRP0);
+
+    nrf_ppi_channel_enable_Expect(PPI_EGU_RAMP_UP);
+
+    nrf_radio_task_trigger_Expect(NRF_RADIO_TASK_DISABLE);
+
+    nrf_802154_hp_timer_trigger_set_Expect(hp_trigger_time);
+    nrf_ppi_channel_enable_Expect(PPI_HP_TIMER_EGU);
+}
+
+static void verify_hp_trigger_withdrawal(void)
+{
+    nrf_ppi_channel_disable_Expect(PPI_HP_TIMER_EGU);
+    nrf_ppi_channel_remove_from_group_Expect(PPI_HP_TIMER_EGU, PPI_CHGRP0);
+}
+
+void setUp(void)
+{
+    m_rsch_timeslot_is_granted = true;
+    m_tx_trigger_is_set        = false;
+}
+
+void tearDown(void)
+{
+
+}
+
+/***************************************************************************************************
+ * @section Notifications
+ **************************************************************************************************/
+
+void nrf_802154_rx_started(void){}
+void nrf_802154_tx_started(const uint8_t * p_frame){}
+
+/***************************************************************************************************
+ * @section HP timer trigger of the transmission ramp up
+ **************************************************************************************************/
+
+void test_tx_trigger_set_ShallArmTriggerForNextTransmission(void)
+{
+    nrf_802154_core_tx_trigger_set(TRIGGER_TIME_LP);
+
+    TEST_ASSERT_TRUE(m_tx_trigger_is_set);
+    TEST_ASSERT_EQUAL_UINT32(TRIGGER_TIME_LP, m_tx_trigger_time);
+}
+
+void test_hp_trigger_ShallNotBeUsedIfNotSet(void)
+{
+    TEST_ASSERT_FALSE(ppis_for_hp_timer_and_ramp_up_set(NRF_RADIO_TASK_TXEN));
+}
+
+void test_hp_trigger_ShallNotBeUsedIfTimersAreNotSynchronized(void)
+{
+    nrf_802154_core_tx_trigger_set(TRIGGER_TIME_LP);
+
+    verify_hp_time_get(false, TRIGGER_TIME_HP);
+
+    TEST_ASSERT_FALSE(ppis_for_hp_timer_and_ramp_up_set(NRF_RADIO_TASK_TXEN));
+    TEST_ASSERT_FALSE(m_tx_trigger_is_set);
+}
+
+void test_hp_trigger_ShallStartRampUpAtTriggerTime(void)
+{
+    nrf_802154_core_tx_trigger_set(TRIGGER_TIME_LP);
+
+    verify_hp_time_get(true, TRIGGER_TIME_HP);
+    verify_hp_trigger_setup(NRF_RADIO_TASK_TXEN, TRIGGER_TIME_HP);
+    nrf_802154_hp_timer_current_time_get_ExpectAndReturn(TRIGGER_TIME_HP - TX_TRIGGER_MARGIN);
+
+    TEST_ASSERT_TRUE(ppis_for_hp_timer_and_ramp_up_set(NRF_RADIO_TASK_TXEN));
+    TEST_ASSERT_FALSE(m_tx_trigger_is_set);
+}
+
+void test_hp_trigger_ShallStartCcaRampUpAtTriggerTime(void)
+{
+    nrf_802154_core_tx_trigger_set(TRIGGER_TIME_LP);
+
+    verify_hp_time_get(true, TRIGGER_TIME_HP);
+    verify_hp_trigger_setup(NRF_RADIO_TASK_RXEN, TRIGGER_TIME_HP);
+    nrf_802154_hp_timer_current_time_get_ExpectAndReturn(TRIGGER_TIME_HP - 1000);
+
+    TEST_ASSERT_TRUE(ppis_for_hp_timer_and_ramp_up_set(NRF_RADIO_TASK_RXEN));
+}
+
+void test_hp_trigger_ShallFallBackToImmediateRampUpIfArmedTooLate(void)
+{
+    nrf_802154_core_tx_trigger_set(TRIGGER_TIME_LP);
+
+    verify_hp_time_get(true, TRIGGER_TIME_HP);
+    verify_hp_trigger_setup(NRF_RADIO_TASK_TXEN, TRIGGER_TIME_HP);
+    nrf_802154_hp_timer_current_time_get_ExpectAndReturn(TRIGGER_TIME_HP - TX_TRIGGER_MARGIN + 1);
+    verify_hp_trigger_withdrawal();
+
+    TEST_ASSERT_FALSE(ppis_for_hp_timer_and_ramp_up_set(NRF_RADIO_TASK_TXEN));
+    TEST_ASSERT_FALSE(m_tx_trigger_is_set);
+}
+
+void test_hp_trigger_ShallFallBackToImmediateRampUpIfTriggerTimeHasPassed(void)
+{
+    nrf_802154_core_tx_trigger_set(TRIGGER_TIME_LP);
+
+    verify_hp_time_get(true, TRIGGER_TIME_HP);
+    verify_hp_trigger_setup(NRF_RADIO_TASK_TXEN, TRIGGER_TIME_HP);
+    nrf_802154_hp_timer_current_time_get_ExpectAndReturn(TRIGGER_TIME_HP + 100);
+    verify_hp_trigger_withdrawal();
+
+    TEST_ASSERT_FALSE(ppis_for_hp_timer_and_ramp_up_set(NRF_RADIO_TASK_TXEN));
+}
+
+void test_hp_trigger_ShallFallBackToImmediateRampUpIfArmedTooLateAcrossTimerOverflow(void)
+{
+    uint32_t hp_trigger_time = TX_TRIGGER_MARGIN / 2;
+
+    nrf_802154_core_tx_trigger_set(TRIGGER_TIME_LP);
+
+    verify_hp_time_get(true, hp_trigger_time);
+    verify_hp_trigger_setup(NRF_RADIO_TASK_TXEN, hp_trigger_time);
+    nrf_802154_hp_timer_current_time_get_ExpectAndReturn(UINT32_MAX);
+    verify_hp_trigger_withdrawal();
+
+    TEST_ASSERT_FALSE(ppis_for_hp_timer_and_ramp_up_set(NRF_RADIO_TASK_TXEN));
+}
@@ -0,0 +1,308 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mock_nrf_gpio.h"
+
+#include "nrf_802154_neighbor.c"
+#include "nrf_802154_ant_div_ctrl.c"
+
+#define ANT_DIV_PIN 26
+
+typedef struct
+{
+    nrf_802154_neighbor_id_t id;
+    uint32_t                 data;
+} test_entry_t;
+
+static const uint8_t test_addr_short[SHORT_ADDRESS_SIZE]       = { 0x12, 0x23 };
+static const uint8_t test_addr_extended[EXTENDED_ADDRESS_SIZE] =
+{ 0x12, 0x23, 0x34, 0x45, 0x56, 0x67, 0x78, 0x89 };
+
+static uint8_t m_frame[MAX_PACKET_SIZE + PHR_SIZE];
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    memset(m_frame, 0, sizeof(m_frame));
+    nrf_gpio_cfg_output_Ignore();
+    nrf_gpio_pin_write_Ignore();
+}
+
+void tearDown(void)
+{
+    memset(m_neighbors, 0, sizeof(m_neighbors));
+    memset(&m_stats, 0, sizeof(m_stats));
+    memset(&m_cfg, 0, sizeof(m_cfg));
+    memset(m_rssi_valid, 0, sizeof(m_rssi_valid));
+    nrf_802154_neighbor_pending_clear(&m_pending);
+    m_frames_count  = 0;
+    m_explore_count = 0;
+}
+
+/** Prepare a Data frame requesting ACK with short destination and source addresses. */
+static void frame_short_prepare(const uint8_t * p_dst_addr)
+{
+    m_frame[0]                     = 20;
+    m_frame[ACK_REQUEST_OFFSET]    = FRAME_TYPE_DATA | ACK_REQUEST_BIT | PAN_ID_COMPR_MASK;
+    m_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT | FRAME_VERSION_1;
+    memcpy(&m_frame[DEST_ADDR_OFFSET], p_dst_addr, SHORT_ADDRESS_SIZE);
+}
+
+static void ant_div_enable(void)
+{
+    nrf_802154_ant_div_cfg_t cfg = { .enable = true, .gpio_pin = ANT_DIV_PIN };
+
+    nrf_802154_ant_div_ctrl_cfg_set(&cfg);
+}
+
+/***********************************************************************************/
+/******************************** ADDRESS PARSING **********************************/
+/***********************************************************************************/
+
+void test_dst_addr_get_ShallReturnShortAddress(void)
+{
+    bool extended = true;
+
+    frame_short_prepare(test_addr_short);
+
+    TEST_ASSERT_EQUAL_PTR(&m_frame[DEST_ADDR_OFFSET],
+                          nrf_802154_neighbor_dst_addr_get(m_frame, &extended));
+    TEST_ASSERT_FALSE(extended);
+}
+
+void test_dst_addr_get_ShallReturnExtendedAddress(void)
+{
+    bool extended = false;
+
+    m_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_EXTENDED;
+
+    TEST_ASSERT_EQUAL_PTR(&m_frame[DEST_ADDR_OFFSET],
+                          nrf_802154_neighbor_dst_addr_get(m_frame, &extended));
+    TEST_ASSERT_TRUE(extended);
+}
+
+void test_dst_addr_get_ShallReturnNullWithoutDestinationAddress(void)
+{
+    bool extended;
+
+    m_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_NONE | SRC_ADDR_TYPE_SHORT;
+
+    TEST_ASSERT_NULL(nrf_802154_neighbor_dst_addr_get(m_frame, &extended));
+}
+
+void test_dst_addr_get_ShallSkipElidedPanIdIn2015Frame(void)
+{
+    bool extended;
+
+    m_frame[PAN_ID_COMPR_OFFSET]   = PAN_ID_COMPR_MASK;
+    m_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_EXTENDED | SRC_ADDR_TYPE_NONE | FRAME_VERSION_2;
+
+    TEST_ASSERT_EQUAL_PTR(&m_frame[DEST_ADDR_OFFSET - PAN_ID_SIZE],
+                          nrf_802154_neighbor_dst_addr_get(m_frame, &extended));
+}
+
+void test_src_addr_get_ShallReturnAddressAfterCompressedPanId(void)
+{
+    bool extended = true;
+
+    frame_short_prepare(test_addr_short);
+
+    TEST_ASSERT_EQUAL_PTR(&m_frame[SRC_ADDR_OFFSET_SHORT_DST],
+                          nrf_802154_neighbor_src_addr_get(m_frame, &extended));
+    TEST_ASSERT_FALSE(extended);
+}
+
+void test_src_addr_get_ShallSkipSourcePanId(void)
+{
+    bool extended = false;
+
+    m_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_EXTENDED | SRC_ADDR_TYPE_EXTENDED;
+
+    TEST_ASSERT_EQUAL_PTR(&m_frame[SRC_ADDR_OFFSET_EXTENDED_DST + PAN_ID_SIZE],
+                          nrf_802154_neighbor_src_addr_get(m_frame, &extended));
+    TEST_ASSERT_TRUE(extended);
+}
+
+/***********************************************************************************/
+/******************************** NEIGHBOR TABLE ***********************************/
+/***********************************************************************************/
+
+void test_find_ShallReturnEntryWithMatchingAddress(void)
+{
+    test_entry_t table[3] = { 0 };
+
+    nrf_802154_neighbor_id_set(&table[0].id, test_addr_extended, true);
+    nrf_802154_neighbor_id_set(&table[2].id, test_addr_short, false);
+
+    TEST_ASSERT_EQUAL_PTR(&table[2],
+                          nrf_802154_neighbor_find(table, sizeof(table[0]), 3, test_addr_short, false));
+    TEST_ASSERT_EQUAL_PTR(&table[0],
+                          nrf_802154_neighbor_find(table, sizeof(table[0]), 3, test_addr_extended, true));
+}
+
+void test_find_ShallIgnoreUnusedEntryAndOtherAddressType(void)
+{
+    test_entry_t table[2] = { 0 };
+
+    nrf_802154_neighbor_id_set(&table[0].id, test_addr_short, false);
+    table[0].id.in_use = false;
+    nrf_802154_neighbor_id_set(&table[1].id, test_addr_extended, true);
+
+    TEST_ASSERT_NULL(nrf_802154_neighbor_find(table, sizeof(table[0]), 2, test_addr_short, false));
+    TEST_ASSERT_NULL(nrf_802154_neighbor_find(table, sizeof(table[0]), 2, test_addr_extended, false));
+}
+
+/***********************************************************************************/
+/********************************* PENDING FRAME ***********************************/
+/***********************************************************************************/
+
+void test_pending_take_ShallReturnDestinationCopiedWhenFrameWasSet(void)
+{
+    nrf_802154_neighbor_pending_t pending = { 0 };
+    nrf_802154_neighbor_id_t      dst;
+
+    frame_short_prepare(test_addr_short);
+    nrf_802154_neighbor_pending_set(&pending, m_frame);
+    memset(m_frame, 0, sizeof(m_frame));
+
+    TEST_ASSERT_TRUE(nrf_802154_neighbor_pending_take(&pending, &dst));
+    TEST_ASSERT_FALSE(dst.extended);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(test_addr_short, dst.addr, SHORT_ADDRESS_SIZE);
+    TEST_ASSERT_NULL(pending.p_frame);
+    TEST_ASSERT_FALSE(nrf_802154_neighbor_pending_take(&pending, &dst));
+}
+
+void test_pending_take_ShallReturnFalseForFrameWithoutDestination(void)
+{
+    nrf_802154_neighbor_pending_t pending = { 0 };
+    nrf_802154_neighbor_id_t      dst;
+
+    m_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_NONE | SRC_ADDR_TYPE_SHORT;
+    nrf_802154_neighbor_pending_set(&pending, m_frame);
+
+    TEST_ASSERT_EQUAL_PTR(m_frame, pending.p_frame);
+    TEST_ASSERT_FALSE(nrf_802154_neighbor_pending_take(&pending, &dst));
+}
+
+/***********************************************************************************/
+/******************************* ANTENNA DIVERSITY *********************************/
+/***********************************************************************************/
+
+void test_ant_div_no_ack_ShallLearnUnknownNeighborWithOtherAntenna(void)
+{
+    nrf_802154_ant_div_antenna_t antenna;
+    neighbor_t                 * p_neighbor;
+
+    ant_div_enable();
+    frame_short_prepare(test_addr_short);
+
+    nrf_802154_ant_div_ctrl_tx_prepare(m_frame);
+    antenna = nrf_802154_ant_div_ctrl_antenna_get();
+
+    TEST_ASSERT_TRUE(nrf_802154_ant_div_ctrl_tx_failed_hook(m_frame,
+                                                            NRF_802154_TX_ERROR_NO_ACK));
+
+    p_neighbor = neighbor_find(test_addr_short, false);
+    TEST_ASSERT_NOT_NULL(p_neighbor);
+    TEST_ASSERT_EQUAL_UINT8(antenna_other(antenna), p_neighbor->antenna);
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.tx_count[antenna]);
+
+    nrf_802154_ant_div_ctrl_tx_prepare(m_frame);
+    TEST_ASSERT_EQUAL_UINT8(antenna_other(antenna), nrf_802154_ant_div_ctrl_antenna_get());
+}
+
+void test_ant_div_ack_ShallLearnUnknownNeighborWithUsedAntenna(void)
+{
+    nrf_802154_ant_div_antenna_t antenna;
+    neighbor_t                 * p_neighbor;
+
+    ant_div_enable();
+    frame_short_prepare(test_addr_short);
+
+    nrf_802154_ant_div_ctrl_tx_prepare(m_frame);
+    antenna = nrf_802154_ant_div_ctrl_antenna_get();
+    nrf_802154_ant_div_ctrl_transmitted_hook(m_frame);
+
+    p_neighbor = neighbor_find(test_addr_short, false);
+    TEST_ASSERT_NOT_NULL(p_neighbor);
+    TEST_ASSERT_EQUAL_UINT8(antenna, p_neighbor->antenna);
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.ack_count[antenna]);
+}
+
+void test_ant_div_tx_failed_ShallNotLearnNeighborIfFrameWasNotTransmitted(void)
+{
+    ant_div_enable();
+    frame_short_prepare(test_addr_short);
+
+    nrf_802154_ant_div_ctrl_tx_prepare(m_frame);
+
+    TEST_ASSERT_TRUE(nrf_802154_ant_div_ctrl_tx_failed_hook(m_frame,
+                                                            NRF_802154_TX_ERROR_BUSY_CHANNEL));
+
+    TEST_ASSERT_NULL(neighbor_find(test_addr_short, false));
+    TEST_ASSERT_NULL(m_pending.p_frame);
+}
+
+void test_ant_div_no_ack_ShallFlipAntennaOfNeighborReplacedDuringTransmission(void)
+{
+    nrf_802154_ant_div_antenna_t antenna;
+    uint8_t                      src_frame[MAX_PACKET_SIZE + PHR_SIZE] = { 0 };
+    uint8_t                      src_addr[SHORT_ADDRESS_SIZE]          = { 0x00, 0x01 };
+
+    ant_div_enable();
+    frame_short_prepare(test_addr_short);
+
+    nrf_802154_ant_div_ctrl_tx_prepare(m_frame);
+    antenna = nrf_802154_ant_div_ctrl_antenna_get();
+
+    // Receptions from other neighbors fill the table while ACK is awaited.
+    src_frame[ACK_REQUEST_OFFSET]    = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK;
+    src_frame[DEST_ADDR_TYPE_OFFSET] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT;
+
+    for (uint8_t i = 0; i < NRF_802154_ANT_DIV_NEIGHBORS; i++)
+    {
+        src_addr[0] = i;
+        memcpy(&src_frame[SRC_ADDR_OFFSET_SHORT_DST], src_addr, SHORT_ADDRESS_SIZE);
+        nrf_802154_ant_div_ctrl_frame_received(src_frame, -60, NRF_802154_ANT_DIV_ANTENNA_1);
+    }
+
+    TEST_ASSERT_TRUE(nrf_802154_ant_div_ctrl_tx_failed_hook(m_frame,
+                                                            NRF_802154_TX_ERROR_NO_ACK));
+
+    TEST_ASSERT_EQUAL_UINT8(antenna_other(antenna),
+                            neighbor_find(test_addr_short, false)->antenna);
+}
@@ -0,0 +1,80 @@
+/* Copyright (c) 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Build of the complete driver with the FFD device profile.
+ *
+ * The test links every module of the driver, so that a feature removed by the profile must not
+ * leave references to its functions.
+ */
+
+#include "unity.h"
+
+#include <stdint.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+
+/// Data frame with short addresses, without ACK request.
+static uint8_t m_frame[] = { 12, 0x41, 0x88, 0x01, 0xcd, 0xab, 0xff, 0xff, 0x34, 0x12, 0x00, 0x00, 0x00 };
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_profile_ShallKeepMacFeatures(void)
+{
+    TEST_ASSERT_EQUAL(1, NRF_802154_ENERGY_DETECTION_ENABLED);
+    TEST_ASSERT_EQUAL(1, NRF_802154_CCA_PROCEDURE_ENABLED);
+    TEST_ASSERT_EQUAL(0, NRF_802154_CONTINUOUS_CARRIER_ENABLED);
+    TEST_ASSERT_EQUAL(1, NRF_802154_DELAYED_TRX_ENABLED);
+    TEST_ASSERT_EQUAL(1, NRF_802154_CSMA_CA_ENABLED);
+    TEST_ASSERT_EQUAL(1, NRF_802154_ACK_TIMEOUT_ENABLED);
+}
+
+void test_transmit_raw_at_ShallBeAvailable(void)
+{
+    bool (* p_transmit_raw_at)(const uint8_t *, bool, uint32_t, uint32_t, uint8_t) =
+        nrf_802154_transmit_raw_at;
+
+    TEST_ASSERT_NOT_NULL(p_transmit_raw_at);
+    (void)m_frame;
+}